@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/pqc-ledger-cli.dir/src/cli/main.cpp.o"
+  "CMakeFiles/pqc-ledger-cli.dir/src/cli/main.cpp.o.d"
+  "bin/pqc-ledger-cli"
+  "bin/pqc-ledger-cli.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/pqc-ledger-cli.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
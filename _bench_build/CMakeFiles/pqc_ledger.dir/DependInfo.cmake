@@ -0,0 +1,44 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/codec/archive.cpp" "CMakeFiles/pqc_ledger.dir/src/codec/archive.cpp.o" "gcc" "CMakeFiles/pqc_ledger.dir/src/codec/archive.cpp.o.d"
+  "/root/repo/src/codec/base64.cpp" "CMakeFiles/pqc_ledger.dir/src/codec/base64.cpp.o" "gcc" "CMakeFiles/pqc_ledger.dir/src/codec/base64.cpp.o.d"
+  "/root/repo/src/codec/base64_simd.cpp" "CMakeFiles/pqc_ledger.dir/src/codec/base64_simd.cpp.o" "gcc" "CMakeFiles/pqc_ledger.dir/src/codec/base64_simd.cpp.o.d"
+  "/root/repo/src/codec/crc32c.cpp" "CMakeFiles/pqc_ledger.dir/src/codec/crc32c.cpp.o" "gcc" "CMakeFiles/pqc_ledger.dir/src/codec/crc32c.cpp.o.d"
+  "/root/repo/src/codec/decode.cpp" "CMakeFiles/pqc_ledger.dir/src/codec/decode.cpp.o" "gcc" "CMakeFiles/pqc_ledger.dir/src/codec/decode.cpp.o.d"
+  "/root/repo/src/codec/encode.cpp" "CMakeFiles/pqc_ledger.dir/src/codec/encode.cpp.o" "gcc" "CMakeFiles/pqc_ledger.dir/src/codec/encode.cpp.o.d"
+  "/root/repo/src/codec/hex.cpp" "CMakeFiles/pqc_ledger.dir/src/codec/hex.cpp.o" "gcc" "CMakeFiles/pqc_ledger.dir/src/codec/hex.cpp.o.d"
+  "/root/repo/src/codec/hex_simd.cpp" "CMakeFiles/pqc_ledger.dir/src/codec/hex_simd.cpp.o" "gcc" "CMakeFiles/pqc_ledger.dir/src/codec/hex_simd.cpp.o.d"
+  "/root/repo/src/codec/peek.cpp" "CMakeFiles/pqc_ledger.dir/src/codec/peek.cpp.o" "gcc" "CMakeFiles/pqc_ledger.dir/src/codec/peek.cpp.o.d"
+  "/root/repo/src/codec/stream.cpp" "CMakeFiles/pqc_ledger.dir/src/codec/stream.cpp.o" "gcc" "CMakeFiles/pqc_ledger.dir/src/codec/stream.cpp.o.d"
+  "/root/repo/src/crypto/address.cpp" "CMakeFiles/pqc_ledger.dir/src/crypto/address.cpp.o" "gcc" "CMakeFiles/pqc_ledger.dir/src/crypto/address.cpp.o.d"
+  "/root/repo/src/crypto/classical.cpp" "CMakeFiles/pqc_ledger.dir/src/crypto/classical.cpp.o" "gcc" "CMakeFiles/pqc_ledger.dir/src/crypto/classical.cpp.o.d"
+  "/root/repo/src/crypto/hash.cpp" "CMakeFiles/pqc_ledger.dir/src/crypto/hash.cpp.o" "gcc" "CMakeFiles/pqc_ledger.dir/src/crypto/hash.cpp.o.d"
+  "/root/repo/src/crypto/pq.cpp" "CMakeFiles/pqc_ledger.dir/src/crypto/pq.cpp.o" "gcc" "CMakeFiles/pqc_ledger.dir/src/crypto/pq.cpp.o.d"
+  "/root/repo/src/crypto/sha256_avx2.cpp" "CMakeFiles/pqc_ledger.dir/src/crypto/sha256_avx2.cpp.o" "gcc" "CMakeFiles/pqc_ledger.dir/src/crypto/sha256_avx2.cpp.o.d"
+  "/root/repo/src/crypto/sha256_shani.cpp" "CMakeFiles/pqc_ledger.dir/src/crypto/sha256_shani.cpp.o" "gcc" "CMakeFiles/pqc_ledger.dir/src/crypto/sha256_shani.cpp.o.d"
+  "/root/repo/src/tx/basic_transaction.cpp" "CMakeFiles/pqc_ledger.dir/src/tx/basic_transaction.cpp.o" "gcc" "CMakeFiles/pqc_ledger.dir/src/tx/basic_transaction.cpp.o.d"
+  "/root/repo/src/tx/batch.cpp" "CMakeFiles/pqc_ledger.dir/src/tx/batch.cpp.o" "gcc" "CMakeFiles/pqc_ledger.dir/src/tx/batch.cpp.o.d"
+  "/root/repo/src/tx/reject_filter.cpp" "CMakeFiles/pqc_ledger.dir/src/tx/reject_filter.cpp.o" "gcc" "CMakeFiles/pqc_ledger.dir/src/tx/reject_filter.cpp.o.d"
+  "/root/repo/src/tx/signing.cpp" "CMakeFiles/pqc_ledger.dir/src/tx/signing.cpp.o" "gcc" "CMakeFiles/pqc_ledger.dir/src/tx/signing.cpp.o.d"
+  "/root/repo/src/tx/tx_batch.cpp" "CMakeFiles/pqc_ledger.dir/src/tx/tx_batch.cpp.o" "gcc" "CMakeFiles/pqc_ledger.dir/src/tx/tx_batch.cpp.o.d"
+  "/root/repo/src/tx/validation.cpp" "CMakeFiles/pqc_ledger.dir/src/tx/validation.cpp.o" "gcc" "CMakeFiles/pqc_ledger.dir/src/tx/validation.cpp.o.d"
+  "/root/repo/src/tx/verify_cache.cpp" "CMakeFiles/pqc_ledger.dir/src/tx/verify_cache.cpp.o" "gcc" "CMakeFiles/pqc_ledger.dir/src/tx/verify_cache.cpp.o.d"
+  "/root/repo/src/tx/verify_coalescer.cpp" "CMakeFiles/pqc_ledger.dir/src/tx/verify_coalescer.cpp.o" "gcc" "CMakeFiles/pqc_ledger.dir/src/tx/verify_coalescer.cpp.o.d"
+  "/root/repo/src/util/cpu_features.cpp" "CMakeFiles/pqc_ledger.dir/src/util/cpu_features.cpp.o" "gcc" "CMakeFiles/pqc_ledger.dir/src/util/cpu_features.cpp.o.d"
+  "/root/repo/src/util/mapped_file.cpp" "CMakeFiles/pqc_ledger.dir/src/util/mapped_file.cpp.o" "gcc" "CMakeFiles/pqc_ledger.dir/src/util/mapped_file.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
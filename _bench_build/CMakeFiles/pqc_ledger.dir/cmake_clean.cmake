@@ -0,0 +1,61 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/pqc_ledger.dir/src/codec/archive.cpp.o"
+  "CMakeFiles/pqc_ledger.dir/src/codec/archive.cpp.o.d"
+  "CMakeFiles/pqc_ledger.dir/src/codec/base64.cpp.o"
+  "CMakeFiles/pqc_ledger.dir/src/codec/base64.cpp.o.d"
+  "CMakeFiles/pqc_ledger.dir/src/codec/base64_simd.cpp.o"
+  "CMakeFiles/pqc_ledger.dir/src/codec/base64_simd.cpp.o.d"
+  "CMakeFiles/pqc_ledger.dir/src/codec/crc32c.cpp.o"
+  "CMakeFiles/pqc_ledger.dir/src/codec/crc32c.cpp.o.d"
+  "CMakeFiles/pqc_ledger.dir/src/codec/decode.cpp.o"
+  "CMakeFiles/pqc_ledger.dir/src/codec/decode.cpp.o.d"
+  "CMakeFiles/pqc_ledger.dir/src/codec/encode.cpp.o"
+  "CMakeFiles/pqc_ledger.dir/src/codec/encode.cpp.o.d"
+  "CMakeFiles/pqc_ledger.dir/src/codec/hex.cpp.o"
+  "CMakeFiles/pqc_ledger.dir/src/codec/hex.cpp.o.d"
+  "CMakeFiles/pqc_ledger.dir/src/codec/hex_simd.cpp.o"
+  "CMakeFiles/pqc_ledger.dir/src/codec/hex_simd.cpp.o.d"
+  "CMakeFiles/pqc_ledger.dir/src/codec/peek.cpp.o"
+  "CMakeFiles/pqc_ledger.dir/src/codec/peek.cpp.o.d"
+  "CMakeFiles/pqc_ledger.dir/src/codec/stream.cpp.o"
+  "CMakeFiles/pqc_ledger.dir/src/codec/stream.cpp.o.d"
+  "CMakeFiles/pqc_ledger.dir/src/crypto/address.cpp.o"
+  "CMakeFiles/pqc_ledger.dir/src/crypto/address.cpp.o.d"
+  "CMakeFiles/pqc_ledger.dir/src/crypto/classical.cpp.o"
+  "CMakeFiles/pqc_ledger.dir/src/crypto/classical.cpp.o.d"
+  "CMakeFiles/pqc_ledger.dir/src/crypto/hash.cpp.o"
+  "CMakeFiles/pqc_ledger.dir/src/crypto/hash.cpp.o.d"
+  "CMakeFiles/pqc_ledger.dir/src/crypto/pq.cpp.o"
+  "CMakeFiles/pqc_ledger.dir/src/crypto/pq.cpp.o.d"
+  "CMakeFiles/pqc_ledger.dir/src/crypto/sha256_avx2.cpp.o"
+  "CMakeFiles/pqc_ledger.dir/src/crypto/sha256_avx2.cpp.o.d"
+  "CMakeFiles/pqc_ledger.dir/src/crypto/sha256_shani.cpp.o"
+  "CMakeFiles/pqc_ledger.dir/src/crypto/sha256_shani.cpp.o.d"
+  "CMakeFiles/pqc_ledger.dir/src/tx/basic_transaction.cpp.o"
+  "CMakeFiles/pqc_ledger.dir/src/tx/basic_transaction.cpp.o.d"
+  "CMakeFiles/pqc_ledger.dir/src/tx/batch.cpp.o"
+  "CMakeFiles/pqc_ledger.dir/src/tx/batch.cpp.o.d"
+  "CMakeFiles/pqc_ledger.dir/src/tx/reject_filter.cpp.o"
+  "CMakeFiles/pqc_ledger.dir/src/tx/reject_filter.cpp.o.d"
+  "CMakeFiles/pqc_ledger.dir/src/tx/signing.cpp.o"
+  "CMakeFiles/pqc_ledger.dir/src/tx/signing.cpp.o.d"
+  "CMakeFiles/pqc_ledger.dir/src/tx/tx_batch.cpp.o"
+  "CMakeFiles/pqc_ledger.dir/src/tx/tx_batch.cpp.o.d"
+  "CMakeFiles/pqc_ledger.dir/src/tx/validation.cpp.o"
+  "CMakeFiles/pqc_ledger.dir/src/tx/validation.cpp.o.d"
+  "CMakeFiles/pqc_ledger.dir/src/tx/verify_cache.cpp.o"
+  "CMakeFiles/pqc_ledger.dir/src/tx/verify_cache.cpp.o.d"
+  "CMakeFiles/pqc_ledger.dir/src/tx/verify_coalescer.cpp.o"
+  "CMakeFiles/pqc_ledger.dir/src/tx/verify_coalescer.cpp.o.d"
+  "CMakeFiles/pqc_ledger.dir/src/util/cpu_features.cpp.o"
+  "CMakeFiles/pqc_ledger.dir/src/util/cpu_features.cpp.o.d"
+  "CMakeFiles/pqc_ledger.dir/src/util/mapped_file.cpp.o"
+  "CMakeFiles/pqc_ledger.dir/src/util/mapped_file.cpp.o.d"
+  "lib/libpqc_ledger.a"
+  "lib/libpqc_ledger.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/pqc_ledger.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
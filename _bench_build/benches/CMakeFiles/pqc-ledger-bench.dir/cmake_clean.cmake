@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/pqc-ledger-bench"
+  "../bin/pqc-ledger-bench.pdb"
+  "CMakeFiles/pqc-ledger-bench.dir/verify.cpp.o"
+  "CMakeFiles/pqc-ledger-bench.dir/verify.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/pqc-ledger-bench.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
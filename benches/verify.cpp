@@ -3,10 +3,12 @@
 #include <vector>
 #include <random>
 #include <fstream>
+#include <filesystem>
 #include <iostream>
 #include <iomanip>
 #include <ctime>
 #include <chrono>
+#include <cstring>
 
 using namespace pqc_ledger;
 
@@ -88,6 +90,35 @@ static void BM_Verify100PQSignedTransactions(benchmark::State& state) {
     // So average per tx = real_time() / 100 (converted to microseconds)
 }
 
+// Benchmark: Verify 100 PQ-signed transactions through the parallel batch API
+// Argument: number of worker threads
+static void BM_VerifyBatch100PQSignedTransactions(benchmark::State& state) {
+    std::vector<Transaction> txs;
+    txs.reserve(100);
+    
+    for (size_t i = 0; i < 100; ++i) {
+        auto [tx, success] = create_and_sign_bench_tx(i);
+        if (!success) {
+            state.SkipWithError("Failed to create signed transaction");
+            return;
+        }
+        txs.push_back(tx);
+    }
+    
+    tx::BatchVerifyOptions options;
+    options.num_threads = static_cast<size_t>(state.range(0));
+    options.min_per_thread = 1;
+    
+    for (auto _ : state) {
+        auto outcomes = tx::verify_batch(txs, 1, options);
+        benchmark::DoNotOptimize(outcomes);
+    }
+    
+    state.SetItemsProcessed(state.iterations() * 100);
+    state.counters["txs_per_second"] = benchmark::Counter(
+        state.iterations() * 100, benchmark::Counter::kIsRate);
+}
+
 // Benchmark: Single transaction verification (for comparison)
 static void BM_VerifySingleTransaction(benchmark::State& state) {
     auto [tx, success] = create_and_sign_bench_tx(0);
@@ -106,6 +137,109 @@ static void BM_VerifySingleTransaction(benchmark::State& state) {
     state.SetItemsProcessed(state.iterations());
 }
 
+// Benchmark: Decode then verify wire bytes (relay path before verify_encoded)
+static void BM_DecodeThenVerifyTransaction(benchmark::State& state) {
+    auto [tx, success] = create_and_sign_bench_tx(0);
+    auto encoded = codec::encode(tx);
+    if (!success || encoded.is_err()) {
+        state.SkipWithError("Failed to create signed transaction");
+        return;
+    }
+    
+    for (auto _ : state) {
+        auto decoded = codec::decode(encoded.value());
+        auto result = tx::verify_transaction(decoded.value(), 1);
+        benchmark::DoNotOptimize(result);
+    }
+    
+    state.SetItemsProcessed(state.iterations());
+}
+
+// Benchmark: Verify wire bytes in place
+static void BM_VerifyEncodedTransaction(benchmark::State& state) {
+    auto [tx, success] = create_and_sign_bench_tx(0);
+    auto encoded = codec::encode(tx);
+    if (!success || encoded.is_err()) {
+        state.SkipWithError("Failed to create signed transaction");
+        return;
+    }
+    
+    for (auto _ : state) {
+        auto result = tx::verify_encoded(encoded.value(), 1);
+        benchmark::DoNotOptimize(result);
+    }
+    
+    state.SetItemsProcessed(state.iterations());
+}
+
+// Benchmark: Block-validation re-verify of wire bytes already seen (cache hit)
+static void BM_VerifyEncodedCachedTransaction(benchmark::State& state) {
+    auto [tx, success] = create_and_sign_bench_tx(0);
+    auto encoded = codec::encode(tx);
+    if (!success || encoded.is_err()) {
+        state.SkipWithError("Failed to create signed transaction");
+        return;
+    }
+    
+    tx::VerifyCache cache;
+    tx::verify_encoded(encoded.value(), 1, cache);  // Admission fills the cache
+    
+    for (auto _ : state) {
+        auto result = tx::verify_encoded(encoded.value(), 1, cache);
+        benchmark::DoNotOptimize(result);
+    }
+    
+    state.SetItemsProcessed(state.iterations());
+}
+
+// Benchmark: Warm a restarted node's cache from a full 65536-key snapshot
+static void BM_VerifyCacheLoadSnapshot(benchmark::State& state) {
+    const std::string path = (std::filesystem::temp_directory_path() /
+                              "pqc_ledger_bench_verify_cache.pqvc").string();
+    tx::VerifyCache cache;
+    Hash32 message{};
+    const std::vector<uint8_t> pubkey(PQ_PUBKEY_SIZE, 0x42);
+    for (uint32_t i = 0; i < cache.capacity(); ++i) {
+        std::memcpy(message.data(), &i, sizeof(i));
+        cache.insert(cache.key(AuthMode::PqOnly, message, pubkey, ByteSpan(), pubkey));
+    }
+    if (cache.save(path).is_err()) {
+        state.SkipWithError("Failed to write snapshot");
+        return;
+    }
+    
+    tx::VerifyCache restarted;
+    for (auto _ : state) {
+        auto loaded = restarted.load(path);
+        benchmark::DoNotOptimize(loaded);
+    }
+    
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(cache.size()));
+    std::filesystem::remove(path);
+}
+
+// Benchmark: Validate a replayed invalid transaction the reject filter has seen
+static void BM_ValidateRejectedReplay(benchmark::State& state) {
+    auto [tx, success] = create_and_sign_bench_tx(1);
+    if (!success) {
+        state.SkipWithError("Failed to create signed transaction");
+        return;
+    }
+    std::get<PqSignature>(tx.auth).sig[10] ^= 0x01;
+    
+    tx::RejectFilter filter;
+    tx::ValidationOptions options;
+    options.rejects = &filter;
+    tx::validate_transaction(tx, 1, options);  // The first copy is verified and recorded
+    
+    for (auto _ : state) {
+        auto result = tx::validate_transaction(tx, 1, options);
+        benchmark::DoNotOptimize(result);
+    }
+    
+    state.SetItemsProcessed(state.iterations());
+}
+
 // Benchmark: Encode transaction (for comparison)
 static void BM_EncodeTransaction(benchmark::State& state) {
     auto [tx, success] = create_and_sign_bench_tx(0);
@@ -122,6 +256,24 @@ static void BM_EncodeTransaction(benchmark::State& state) {
     state.SetItemsProcessed(state.iterations());
 }
 
+// Benchmark: Encode transaction into a reused buffer (no allocation)
+static void BM_EncodeIntoTransaction(benchmark::State& state) {
+    auto [tx, success] = create_and_sign_bench_tx(0);
+    if (!success) {
+        state.SkipWithError("Failed to create signed transaction");
+        return;
+    }
+    
+    std::vector<uint8_t> buffer(codec::encoded_size(tx));
+    for (auto _ : state) {
+        auto result = codec::encode_into(tx, buffer);
+        benchmark::DoNotOptimize(result);
+        benchmark::DoNotOptimize(buffer.data());
+    }
+    
+    state.SetItemsProcessed(state.iterations());
+}
+
 // Benchmark: Decode transaction (for comparison)
 static void BM_DecodeTransaction(benchmark::State& state) {
     auto [tx, success] = create_and_sign_bench_tx(0);
@@ -144,6 +296,481 @@ static void BM_DecodeTransaction(benchmark::State& state) {
     state.SetItemsProcessed(state.iterations());
 }
 
+// Benchmark: Zero-copy view decode (for comparison with BM_DecodeTransaction)
+static void BM_DecodeViewTransaction(benchmark::State& state) {
+    auto [tx, success] = create_and_sign_bench_tx(0);
+    if (!success) {
+        state.SkipWithError("Failed to create signed transaction");
+        return;
+    }
+    
+    auto encoded = codec::encode(tx);
+    if (encoded.is_err()) {
+        state.SkipWithError("Failed to encode transaction for decode benchmark");
+        return;
+    }
+    const auto& bytes = encoded.value();
+    
+    for (auto _ : state) {
+        auto result = codec::decode_view(bytes.data(), bytes.size());
+        benchmark::DoNotOptimize(result);
+    }
+    
+    state.SetItemsProcessed(state.iterations());
+}
+
+// Benchmark: Decode into a fixed-size ML-DSA-65 transaction (constant offsets, no allocation)
+static void BM_DecodeFixedTransaction(benchmark::State& state) {
+    auto [tx, success] = create_and_sign_bench_tx(0);
+    if (!success) {
+        state.SkipWithError("Failed to create signed transaction");
+        return;
+    }
+    
+    auto encoded = codec::encode(tx);
+    if (encoded.is_err()) {
+        state.SkipWithError("Failed to encode transaction for decode benchmark");
+        return;
+    }
+    const auto& bytes = encoded.value();
+    
+    FixedTransaction fixed;
+    for (auto _ : state) {
+        auto result = codec::decode(bytes, fixed);
+        benchmark::DoNotOptimize(result);
+        benchmark::DoNotOptimize(fixed);
+    }
+    
+    state.SetItemsProcessed(state.iterations());
+}
+
+// Benchmark: Domain-separated signing message (streamed into SHA-256)
+static void BM_SigningMessage(benchmark::State& state) {
+    auto [tx, success] = create_and_sign_bench_tx(0);
+    if (!success) {
+        state.SkipWithError("Failed to create signed transaction");
+        return;
+    }
+    
+    for (auto _ : state) {
+        auto result = tx::compute_signing_message(tx, 1);
+        benchmark::DoNotOptimize(result);
+    }
+    
+    state.SetItemsProcessed(state.iterations());
+}
+
+// Benchmark: SHA-256 of a pubkey-sized (1952-byte) input per backend
+static void BM_Sha256Backend(benchmark::State& state) {
+    auto backend = static_cast<crypto::Sha256Backend>(state.range(0));
+    if (!crypto::sha256_backend_available(backend)) {
+        state.SkipWithError("Backend not available on this machine");
+        return;
+    }
+    state.SetLabel(crypto::sha256_backend_name(backend));
+    
+    std::vector<uint8_t> data(PQ_PUBKEY_SIZE, 0x42);
+    for (auto _ : state) {
+        auto result = crypto::sha256(data, backend);
+        benchmark::DoNotOptimize(result);
+    }
+    
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(data.size()));
+}
+
+// Benchmark: SHA-256 of 64 pubkey-sized inputs at once, per backend
+static void BM_Sha256ManyBackend(benchmark::State& state) {
+    auto backend = static_cast<crypto::Sha256Backend>(state.range(0));
+    if (!crypto::sha256_backend_available(backend)) {
+        state.SkipWithError("Backend not available on this machine");
+        return;
+    }
+    state.SetLabel(crypto::sha256_backend_name(backend));
+    
+    std::vector<std::vector<uint8_t>> messages(64, std::vector<uint8_t>(PQ_PUBKEY_SIZE, 0x42));
+    std::vector<ByteSpan> inputs(messages.begin(), messages.end());
+    std::vector<Hash32> outputs(messages.size());
+    for (auto _ : state) {
+        auto result = crypto::sha256_many(inputs, outputs, backend);
+        benchmark::DoNotOptimize(result);
+        benchmark::DoNotOptimize(outputs.data());
+    }
+    
+    state.SetBytesProcessed(state.iterations() *
+                            static_cast<int64_t>(messages.size() * PQ_PUBKEY_SIZE));
+}
+
+// Benchmark: hex encoding of a signed transaction, per backend
+static void BM_HexEncodeTransaction(benchmark::State& state) {
+    auto backend = static_cast<codec::HexBackend>(state.range(0));
+    if (!codec::hex_backend_available(backend)) {
+        state.SkipWithError("Backend not available on this machine");
+        return;
+    }
+    state.SetLabel(codec::hex_backend_name(backend));
+    
+    auto [tx, ok] = create_and_sign_bench_tx(0);
+    auto encoded = codec::encode(tx);
+    if (!ok || encoded.is_err()) {
+        state.SkipWithError("Failed to create transaction");
+        return;
+    }
+    const auto& bytes = encoded.value();
+    std::string hex(codec::hex_encoded_size(bytes.size()), '\0');
+    
+    for (auto _ : state) {
+        codec::hex_encode_into(bytes, hex.data(), backend);
+        benchmark::DoNotOptimize(hex.data());
+    }
+    
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(bytes.size()));
+}
+
+// Benchmark: hex decoding of a signed transaction, per backend
+static void BM_HexDecodeTransaction(benchmark::State& state) {
+    auto backend = static_cast<codec::HexBackend>(state.range(0));
+    if (!codec::hex_backend_available(backend)) {
+        state.SkipWithError("Backend not available on this machine");
+        return;
+    }
+    state.SetLabel(codec::hex_backend_name(backend));
+    
+    auto [tx, ok] = create_and_sign_bench_tx(0);
+    auto encoded = codec::encode(tx);
+    if (!ok || encoded.is_err()) {
+        state.SkipWithError("Failed to create transaction");
+        return;
+    }
+    const std::string hex = codec::hex_encode(encoded.value());
+    std::vector<uint8_t> bytes(hex.size() / 2);
+    
+    for (auto _ : state) {
+        auto written = codec::hex_decode_into(hex, bytes, backend);
+        benchmark::DoNotOptimize(written);
+        benchmark::DoNotOptimize(bytes.data());
+    }
+    
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(bytes.size()));
+}
+
+// Benchmark: base64 encoding of a signed transaction, per backend
+static void BM_Base64EncodeTransaction(benchmark::State& state) {
+    auto backend = static_cast<codec::Base64Backend>(state.range(0));
+    if (!codec::base64_backend_available(backend)) {
+        state.SkipWithError("Backend not available on this machine");
+        return;
+    }
+    state.SetLabel(codec::base64_backend_name(backend));
+    
+    auto [tx, ok] = create_and_sign_bench_tx(0);
+    auto encoded = codec::encode(tx);
+    if (!ok || encoded.is_err()) {
+        state.SkipWithError("Failed to create transaction");
+        return;
+    }
+    const auto& bytes = encoded.value();
+    std::string text(codec::base64_encoded_size(bytes.size()), '\0');
+    
+    for (auto _ : state) {
+        codec::base64_encode_into(bytes, text.data(), backend);
+        benchmark::DoNotOptimize(text.data());
+    }
+    
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(bytes.size()));
+}
+
+// Benchmark: base64 decoding of a signed transaction, per backend
+static void BM_Base64DecodeTransaction(benchmark::State& state) {
+    auto backend = static_cast<codec::Base64Backend>(state.range(0));
+    if (!codec::base64_backend_available(backend)) {
+        state.SkipWithError("Backend not available on this machine");
+        return;
+    }
+    state.SetLabel(codec::base64_backend_name(backend));
+    
+    auto [tx, ok] = create_and_sign_bench_tx(0);
+    auto encoded = codec::encode(tx);
+    if (!ok || encoded.is_err()) {
+        state.SkipWithError("Failed to create transaction");
+        return;
+    }
+    const std::string text = codec::base64_encode(encoded.value());
+    std::vector<uint8_t> bytes(text.size() / 4 * 3);
+    
+    for (auto _ : state) {
+        auto written = codec::base64_decode_into(text, bytes, backend);
+        benchmark::DoNotOptimize(written);
+        benchmark::DoNotOptimize(bytes.data());
+    }
+    
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(encoded.value().size()));
+}
+
+// Mempool-sized set of transactions with distinct fees
+std::vector<Transaction> make_fee_scan_txs(size_t count) {
+    std::vector<Transaction> txs;
+    txs.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        Transaction tx;
+        tx.version = 1;
+        tx.chain_id = 1;
+        tx.nonce = i + 1;
+        tx.from_pubkey = std::vector<uint8_t>(PQ_PUBKEY_SIZE, 0x42);
+        tx.to = {};
+        tx.amount = 1000;
+        tx.fee = 10 + (i * 7919) % 1000;
+        tx.auth_mode = AuthMode::PqOnly;
+        tx.auth = PqSignature{std::vector<uint8_t>(PQ_SIG_SIZE, 0x55)};
+        txs.push_back(std::move(tx));
+    }
+    return txs;
+}
+
+// Benchmark: Sum of fees over 4096 transactions stored as std::vector<Transaction>
+static void BM_FeeScanTransactions(benchmark::State& state) {
+    auto txs = make_fee_scan_txs(4096);
+    
+    for (auto _ : state) {
+        uint64_t total = 0;
+        for (const auto& tx : txs) {
+            total += tx.fee;
+        }
+        benchmark::DoNotOptimize(total);
+    }
+    
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(txs.size()));
+}
+
+// Benchmark: Same scan over the fee column of a TxBatch
+static void BM_FeeScanTxBatch(benchmark::State& state) {
+    auto txs = make_fee_scan_txs(4096);
+    tx::TxBatch batch;
+    batch.reserve(txs.size());
+    for (const auto& tx : txs) {
+        batch.push_back(tx);
+    }
+    
+    for (auto _ : state) {
+        uint64_t total = 0;
+        for (uint64_t fee : batch.fees()) {
+            total += fee;
+        }
+        benchmark::DoNotOptimize(total);
+    }
+    
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(batch.size()));
+}
+
+// Benchmark: Decode 256 transactions into a TxBatch and run the cheap checks
+static void BM_DecodeBatchCheap(benchmark::State& state) {
+    auto txs = make_fee_scan_txs(256);
+    std::vector<std::vector<uint8_t>> encoded;
+    for (const auto& tx : txs) {
+        encoded.push_back(codec::encode(tx).value());
+    }
+    std::vector<ByteSpan> inputs(encoded.begin(), encoded.end());
+    
+    tx::TxBatch batch;
+    batch.reserve(inputs.size());
+    for (auto _ : state) {
+        batch.clear();
+        auto decoded = tx::decode_batch(inputs, batch);
+        auto checked = tx::validate_cheap_checks_batch(batch, 1);
+        benchmark::DoNotOptimize(decoded);
+        benchmark::DoNotOptimize(checked);
+    }
+    
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(inputs.size()));
+}
+
+// Benchmark: Read and decode 256 checksummed transactions from a stream in memory
+static void BM_TxStreamRead(benchmark::State& state) {
+    auto txs = make_fee_scan_txs(256);
+    std::vector<uint8_t> stream;
+    {
+        codec::TxStreamWriter writer(codec::vector_sink(stream));
+        for (const auto& tx : txs) {
+            writer.write(tx);
+        }
+        writer.flush();
+    }
+    
+    for (auto _ : state) {
+        codec::TxStreamReader reader{ByteSpan(stream)};
+        TransactionView view;
+        uint64_t total = 0;
+        while (reader.next(view).value()) {
+            total += view.fee;
+        }
+        benchmark::DoNotOptimize(total);
+    }
+    
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(txs.size()));
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(stream.size()));
+}
+
+// Archive of 4096 transactions in the temp directory, written once per process
+static const std::string& bench_archive_path() {
+    static const std::string path = [] {
+        std::string file = (std::filesystem::temp_directory_path() /
+                            "pqc_ledger_bench_archive.pqba").string();
+        std::vector<uint8_t> bytes;
+        codec::ArchiveWriter writer(codec::vector_sink(bytes));
+        for (const auto& tx : make_fee_scan_txs(4096)) {
+            writer.append(tx);
+        }
+        writer.finish();
+        std::ofstream out(file, std::ios::binary | std::ios::trunc);
+        out.write(reinterpret_cast<const char*>(bytes.data()),
+                  static_cast<std::streamsize>(bytes.size()));
+        return file;
+    }();
+    return path;
+}
+
+// Benchmark: Open a 4096-transaction archive (mmap + header/footer checks)
+static void BM_ArchiveOpen(benchmark::State& state) {
+    const std::string& path = bench_archive_path();
+    
+    for (auto _ : state) {
+        auto reader = codec::ArchiveReader::open(path);
+        benchmark::DoNotOptimize(reader.value().size());
+    }
+}
+
+// Benchmark: Decode one transaction at a scattered position of a mapped archive
+static void BM_ArchiveRandomAccess(benchmark::State& state) {
+    auto reader = codec::ArchiveReader::open(bench_archive_path());
+    const auto& archive = reader.value();
+    
+    uint64_t index = 0;
+    for (auto _ : state) {
+        index = (index + 2591) % archive.size();
+        auto view = archive.at(index);
+        benchmark::DoNotOptimize(view.value().fee);
+    }
+    
+    state.SetItemsProcessed(state.iterations());
+}
+
+// Benchmark: Admission precheck on raw bytes (wrong-chain spam), no decode
+static void BM_PrecheckRawWrongChain(benchmark::State& state) {
+    auto txs = make_fee_scan_txs(1);
+    auto encoded = codec::encode(txs[0]);
+    if (encoded.is_err()) {
+        state.SkipWithError("Failed to encode transaction");
+        return;
+    }
+    const auto& bytes = encoded.value();
+    
+    for (auto _ : state) {
+        ErrorCode error = ErrorCode::UnknownError;
+        bool passed = tx::precheck_raw(bytes, 2, error);
+        benchmark::DoNotOptimize(passed);
+        benchmark::DoNotOptimize(error);
+    }
+    
+    state.SetItemsProcessed(state.iterations());
+}
+
+// Malformed inputs mirroring the rejection cases in tests/mutation.cpp
+std::vector<std::vector<uint8_t>> make_malformed_inputs() {
+    Transaction tx;
+    tx.version = 1;
+    tx.chain_id = 1;
+    tx.nonce = 12345;
+    tx.from_pubkey = std::vector<uint8_t>(1952, 0x42);
+    tx.to = {};
+    std::fill(tx.to.begin(), tx.to.end(), 0xAA);
+    tx.amount = 1000;
+    tx.fee = 10;
+    tx.auth_mode = AuthMode::PqOnly;
+    tx.auth = PqSignature{std::vector<uint8_t>(3309, 0x55)};
+    
+    std::vector<std::vector<uint8_t>> inputs;
+    const auto valid = codec::encode(tx).value();
+    const size_t len_prefix_offset = 1 + 4 + 8;
+    
+    // Flipped pubkey length prefix
+    auto flipped = valid;
+    flipped[len_prefix_offset] ^= 0xFF;
+    inputs.push_back(flipped);
+    
+    // Trailing bytes
+    auto trailing = valid;
+    trailing.push_back(0x42);
+    trailing.push_back(0xAA);
+    inputs.push_back(trailing);
+    
+    // Wrong pubkey size
+    auto wrong_pubkey = tx;
+    wrong_pubkey.from_pubkey.resize(1000);
+    inputs.push_back(codec::encode(wrong_pubkey).value());
+    
+    // Wrong signature size
+    auto wrong_sig = tx;
+    wrong_sig.auth = PqSignature{std::vector<uint8_t>(1000, 0x55)};
+    inputs.push_back(codec::encode(wrong_sig).value());
+    
+    // Wrong Ed25519 signature size
+    auto wrong_ed25519 = tx;
+    wrong_ed25519.auth_mode = AuthMode::Hybrid;
+    wrong_ed25519.auth = HybridSignature{std::vector<uint8_t>(32, 0x11),
+                                         std::vector<uint8_t>(3309, 0x22)};
+    inputs.push_back(codec::encode(wrong_ed25519).value());
+    
+    // Length prefix exceeding the buffer
+    auto huge_len = valid;
+    huge_len[len_prefix_offset] = 0xFF;
+    huge_len[len_prefix_offset + 1] = 0xFF;
+    inputs.push_back(huge_len);
+    
+    // Truncated in the middle of the signature
+    inputs.push_back(std::vector<uint8_t>(valid.begin(), valid.end() - 100));
+    
+    return inputs;
+}
+
+// Benchmark: Reject malformed transactions through the Result-returning decoder
+static void BM_RejectMalformed(benchmark::State& state) {
+    const auto inputs = make_malformed_inputs();
+    size_t rejected = 0;
+    
+    for (auto _ : state) {
+        for (const auto& input : inputs) {
+            auto result = codec::decode(input);
+            rejected += result.is_err() ? 1 : 0;
+            benchmark::DoNotOptimize(result);
+        }
+    }
+    
+    if (rejected != state.iterations() * inputs.size()) {
+        state.SkipWithError("A malformed input was accepted");
+    }
+    state.SetItemsProcessed(state.iterations() * inputs.size());
+}
+
+// Benchmark: Reject malformed transactions through the non-allocating decoder
+static void BM_TryRejectMalformed(benchmark::State& state) {
+    const auto inputs = make_malformed_inputs();
+    size_t rejected = 0;
+    
+    for (auto _ : state) {
+        for (const auto& input : inputs) {
+            TransactionView view;
+            ErrorCode error = ErrorCode::UnknownError;
+            bool ok = codec::try_decode_view(input.data(), input.size(), view, error);
+            rejected += ok ? 0 : 1;
+            benchmark::DoNotOptimize(error);
+        }
+    }
+    
+    if (rejected != state.iterations() * inputs.size()) {
+        state.SkipWithError("A malformed input was accepted");
+    }
+    state.SetItemsProcessed(state.iterations() * inputs.size());
+}
+
 // Register benchmarks
 // Main requirement: Verify 100 PQ-signed transactions (reproducible with fixed iterations)
 BENCHMARK(BM_Verify100PQSignedTransactions)
@@ -152,10 +779,64 @@ BENCHMARK(BM_Verify100PQSignedTransactions)
     ->Repetitions(3)  // Run 3 times and report average
     ->ReportAggregatesOnly(false);  // Show all runs for transparency
 
+// Batch verification scaling with worker threads
+BENCHMARK(BM_VerifyBatch100PQSignedTransactions)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime()
+    ->Arg(1)->Arg(2)->Arg(4)->Arg(8)->Arg(16)->Arg(32);
+
 // Additional benchmarks for comparison
 BENCHMARK(BM_VerifySingleTransaction)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_DecodeThenVerifyTransaction)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_VerifyEncodedTransaction)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_VerifyEncodedCachedTransaction)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_VerifyCacheLoadSnapshot)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_ValidateRejectedReplay)->Unit(benchmark::kMicrosecond);
 BENCHMARK(BM_EncodeTransaction)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_EncodeIntoTransaction)->Unit(benchmark::kMicrosecond);
 BENCHMARK(BM_DecodeTransaction)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_DecodeViewTransaction)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_DecodeFixedTransaction)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_SigningMessage)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_Sha256Backend)
+    ->Arg(static_cast<int>(crypto::Sha256Backend::Portable))
+    ->Arg(static_cast<int>(crypto::Sha256Backend::ShaNi))
+    ->Arg(static_cast<int>(crypto::Sha256Backend::OpenSsl))
+    ->Arg(static_cast<int>(crypto::Sha256Backend::Avx2));
+BENCHMARK(BM_Sha256ManyBackend)
+    ->Arg(static_cast<int>(crypto::Sha256Backend::Portable))
+    ->Arg(static_cast<int>(crypto::Sha256Backend::ShaNi))
+    ->Arg(static_cast<int>(crypto::Sha256Backend::OpenSsl))
+    ->Arg(static_cast<int>(crypto::Sha256Backend::Avx2));
+BENCHMARK(BM_HexEncodeTransaction)
+    ->Arg(static_cast<int>(codec::HexBackend::Portable))
+    ->Arg(static_cast<int>(codec::HexBackend::Ssse3))
+    ->Arg(static_cast<int>(codec::HexBackend::Avx2))
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_HexDecodeTransaction)
+    ->Arg(static_cast<int>(codec::HexBackend::Portable))
+    ->Arg(static_cast<int>(codec::HexBackend::Ssse3))
+    ->Arg(static_cast<int>(codec::HexBackend::Avx2))
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_Base64EncodeTransaction)
+    ->Arg(static_cast<int>(codec::Base64Backend::Portable))
+    ->Arg(static_cast<int>(codec::Base64Backend::Ssse3))
+    ->Arg(static_cast<int>(codec::Base64Backend::Avx2))
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_Base64DecodeTransaction)
+    ->Arg(static_cast<int>(codec::Base64Backend::Portable))
+    ->Arg(static_cast<int>(codec::Base64Backend::Ssse3))
+    ->Arg(static_cast<int>(codec::Base64Backend::Avx2))
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_FeeScanTransactions)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_FeeScanTxBatch)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_DecodeBatchCheap)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_TxStreamRead)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_ArchiveOpen)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_ArchiveRandomAccess)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_PrecheckRawWrongChain)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_RejectMalformed)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_TryRejectMalformed)->Unit(benchmark::kMicrosecond);
 
 // Custom main to print average verify time and generate CSV
 int main(int argc, char** argv) {
@@ -0,0 +1,75 @@
+#pragma once
+
+#include "types.hpp"
+#include "error.hpp"
+#include "crypto/params.hpp"
+#include <array>
+#include <cstdint>
+
+namespace pqc_ledger {
+
+/**
+ * Transaction specialized for one ML-DSA parameter set.
+ *
+ * The public key and signatures are inline std::arrays sized by Params, so a
+ * BasicTransaction never allocates and every field of its encoding sits at a
+ * compile-time offset. The codec and signing overloads for it (codec/encode.hpp,
+ * codec/decode.hpp, tx/signing.hpp) are instantiated for MlDsa44, MlDsa65 and
+ * MlDsa87.
+ *
+ * It always carries full-size signatures: an unsigned transaction is one whose
+ * signature arrays have not been filled in yet. The dynamic Transaction remains
+ * the general representation; convert with from_transaction()/to_transaction().
+ */
+template<typename Params>
+struct BasicTransaction {
+    using params = Params;
+
+    // Wire layout (see codec::encode): offsets of the fixed-position fields
+    static constexpr size_t kPubkeyLenOffset = 1 + 4 + 8;
+    static constexpr size_t kPubkeyOffset = kPubkeyLenOffset + 2;
+    static constexpr size_t kToOffset = kPubkeyOffset + Params::pubkey_size;
+    static constexpr size_t kAmountOffset = kToOffset + 32;
+    static constexpr size_t kFeeOffset = kAmountOffset + 8;
+    static constexpr size_t kUnsignedSize = kFeeOffset + 8;  // Signed-over prefix
+    static constexpr size_t kAuthTagOffset = kUnsignedSize;
+
+    static constexpr size_t kPqOnlyEncodedSize = kAuthTagOffset + 1 + 2 + Params::signature_size;
+    static constexpr size_t kHybridEncodedSize =
+        kAuthTagOffset + 1 + 2 + ED25519_SIG_SIZE + 2 + Params::signature_size;
+
+    uint8_t version = 1;
+    uint32_t chain_id = 0;
+    uint64_t nonce = 0;
+    std::array<uint8_t, Params::pubkey_size> from_pubkey{};
+    Address to{};
+    uint64_t amount = 0;
+    uint64_t fee = 0;
+    AuthMode auth_mode = AuthMode::PqOnly;
+
+    std::array<uint8_t, ED25519_SIG_SIZE> classical_sig{};  // Hybrid only
+    std::array<uint8_t, Params::signature_size> pq_sig{};
+
+    size_t encoded_size() const {
+        return auth_mode == AuthMode::Hybrid ? kHybridEncodedSize : kPqOnlyEncodedSize;
+    }
+
+    /**
+     * Convert from a dynamic transaction.
+     *
+     * Empty signatures (an unsigned transaction) are accepted and left zeroed;
+     * any other size must match Params exactly.
+     *
+     * @param tx Transaction to convert
+     * @return Result containing the fixed-size transaction or error
+     */
+    static Result<BasicTransaction> from_transaction(const Transaction& tx);
+
+    // Copy into a dynamic Transaction
+    Transaction to_transaction() const;
+};
+
+// Fixed-size transaction for the parameter set used by the transaction format
+using FixedTransaction = BasicTransaction<crypto::DefaultPqParams>;
+
+} // namespace pqc_ledger
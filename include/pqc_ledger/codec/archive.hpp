@@ -0,0 +1,210 @@
+#pragma once
+
+#include "../types.hpp"
+#include "../error.hpp"
+#include "../span.hpp"
+#include "stream.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace pqc_ledger::util {
+class MappedFile;
+}
+
+namespace pqc_ledger::codec {
+
+/**
+ * Transaction archive format (blocks and historical batches).
+ *
+ *   header:      "PQBA" | version u8 (= 1) | reserved u8[3] (= 0)
+ *   tx region:   canonical encodings (encode()) back to back, no framing
+ *   offset index: (count + 1) x u64 absolute offset; entry i is where
+ *                transaction i starts, entry count is the end of the region
+ *   txid table:  count x (txid[32] | position u64), sorted by txid
+ *   footer:      count u64 | index offset u64 | txid table offset u64 |
+ *                crc32c u32 of offset index and txid table | "PQBE"
+ *
+ * Integers are big-endian like the transaction encoding. Everything needed to
+ * locate transaction N is in the fixed-size header and footer, so opening an
+ * archive of any size reads two pages, and reading one transaction touches
+ * one index entry and the pages holding its encoding. The footer comes last
+ * so archives can be written in one pass to a pipe or an append-only file.
+ */
+constexpr size_t ARCHIVE_HEADER_SIZE = 8;
+constexpr size_t ARCHIVE_FOOTER_SIZE = 32;
+constexpr size_t ARCHIVE_TXID_ENTRY_SIZE = 40;
+constexpr uint8_t ARCHIVE_VERSION = 1;
+
+/**
+ * Transaction id: SHA-256 of the transaction's canonical encoding, signatures
+ * included. Unlike the signing message it is not domain-separated by chain;
+ * the chain id is part of the encoding.
+ *
+ * @param encoded Canonical encoding of the transaction
+ * @return 32-byte txid
+ */
+Hash32 compute_txid(ByteSpan encoded) noexcept;
+
+/**
+ * Txid of a decoded transaction, hashed while encoding it (no buffer).
+ *
+ * @param tx Transaction
+ * @return Result containing the txid, or error if tx is not encodable
+ */
+Result<Hash32> compute_txid(const Transaction& tx);
+
+/**
+ * One-pass writer for the archive format.
+ *
+ * Encodings are buffered and handed to the sink like TxStreamWriter does;
+ * the offset index and txid table (48 bytes per transaction) are kept in
+ * memory until finish() writes them out with the footer. An archive whose
+ * writer is destroyed without finish() is incomplete and will not open.
+ */
+class ArchiveWriter {
+public:
+    /**
+     * @param sink Receives the archive bytes
+     * @param buffer_size Bytes collected before they are handed to the sink
+     */
+    explicit ArchiveWriter(ByteSink sink, size_t buffer_size = 64 * 1024);
+
+    ArchiveWriter(const ArchiveWriter&) = delete;
+    ArchiveWriter& operator=(const ArchiveWriter&) = delete;
+
+    /**
+     * Append a transaction.
+     *
+     * @param tx Transaction to encode
+     * @return Result indicating success, the encoder's error (nothing is written),
+     *         or the sink's error
+     */
+    Result<void> append(const Transaction& tx);
+
+    /**
+     * Append an already encoded transaction. It is decoded strictly first so
+     * that an archive only ever holds canonical encodings.
+     *
+     * @param encoded Canonical encoding of one transaction
+     * @return Result indicating success, the decoder's error, or the sink's error
+     */
+    Result<void> append_encoded(ByteSpan encoded);
+
+    /**
+     * Write the offset index, txid table and footer, and flush everything.
+     * Nothing can be appended afterwards.
+     *
+     * @return Result indicating success or the sink's error
+     */
+    Result<void> finish();
+
+    // Transactions appended so far
+    uint64_t size() const { return offsets_.size(); }
+
+private:
+    Result<void> append_checked(ByteSpan encoded);
+    Result<void> put(ByteSpan data);
+    Result<void> flush();
+
+    ByteSink sink_;
+    size_t buffer_size_;
+    std::vector<uint8_t> buffer_;
+    uint64_t written_;                              // Archive offset of buffer_[0]
+    std::vector<uint64_t> offsets_;
+    std::vector<std::pair<Hash32, uint64_t>> txids_;
+    bool finished_;
+};
+
+/**
+ * Random-access reader for the archive format.
+ *
+ * Reads a memory-mapped file or a caller-owned memory region. Opening only
+ * checks the header and footer; per-transaction accessors bounds-check the
+ * index entries they use, so a corrupt archive yields errors rather than
+ * out-of-range reads. verify() checks everything for audit jobs.
+ *
+ * Views and spans returned by the accessors borrow from the mapping and stay
+ * valid as long as the reader (or, for over(), the region).
+ */
+class ArchiveReader {
+public:
+    // Empty reader (no transactions)
+    ArchiveReader() noexcept;
+    ~ArchiveReader();
+
+    ArchiveReader(ArchiveReader&& other) noexcept;
+    ArchiveReader& operator=(ArchiveReader&& other) noexcept;
+
+    /**
+     * Map an archive file.
+     *
+     * @param path Archive file, which must not change while it is open
+     * @return Result containing the reader, FileReadError if the file cannot be
+     *         mapped, or InvalidArchive if the header or footer is malformed
+     */
+    static Result<ArchiveReader> open(const std::string& path);
+
+    /**
+     * Read an archive in memory; data must outlive the reader.
+     *
+     * @param data Complete archive bytes
+     * @return Result containing the reader, or InvalidArchive
+     */
+    static Result<ArchiveReader> over(ByteSpan data);
+
+    // Number of transactions
+    uint64_t size() const { return count_; }
+
+    /**
+     * Canonical encoding of transaction index.
+     *
+     * @param index Position in the archive (0-based)
+     * @return Result containing the encoding, or InvalidArchive for an index out
+     *         of range or a corrupt index entry
+     */
+    Result<ByteSpan> encoded(uint64_t index) const;
+
+    /**
+     * Decode transaction index in place (as decode_view()).
+     *
+     * @param index Position in the archive (0-based)
+     * @return Result containing a view into the archive, or error
+     */
+    Result<TransactionView> at(uint64_t index) const;
+
+    /**
+     * Look up a transaction by txid (binary search of the txid table).
+     *
+     * @param txid Transaction id (compute_txid())
+     * @param index Receives the transaction's position when found
+     * @return Result containing whether the txid is in the archive, or
+     *         InvalidArchive for a corrupt table entry
+     */
+    Result<bool> find(const Hash32& txid, uint64_t& index) const;
+
+    /**
+     * Check the whole archive: index and txid table checksum, monotonic offsets,
+     * every transaction decoding strictly, and the txid table matching the
+     * transactions. Reads every page of the archive.
+     *
+     * @return Result indicating success, or the first problem found
+     */
+    Result<void> verify() const;
+
+private:
+    Result<void> parse(ByteSpan data);
+    uint64_t offset_at(uint64_t index) const;
+
+    std::unique_ptr<util::MappedFile> file_;  // Null for over()
+    const uint8_t* data_;
+    uint64_t size_;
+    uint64_t count_;
+    uint64_t index_offset_;
+    uint64_t txid_offset_;
+};
+
+} // namespace pqc_ledger::codec
@@ -0,0 +1,152 @@
+#pragma once
+
+#include "../error.hpp"
+#include "../span.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace pqc_ledger::codec {
+
+/**
+ * Base64 codec implementations (standard alphabet, '=' padding). base64_backend()
+ * picks the fastest one the CPU supports; the others can be requested explicitly.
+ * All backends produce identical output and report identical errors.
+ */
+enum class Base64Backend : uint8_t {
+    Portable,  // Table-driven scalar C++, always available
+    Ssse3,     // 12 bytes / 16 characters per step
+    Avx2,      // 24 bytes / 32 characters per step
+};
+
+/**
+ * Backend used by the base64 functions on this machine.
+ * Preference: Avx2, then Ssse3, then Portable.
+ */
+Base64Backend base64_backend();
+
+/**
+ * Check whether a backend can run on this machine and build.
+ */
+bool base64_backend_available(Base64Backend backend);
+
+/**
+ * Short backend name for logs and benchmark labels (e.g. "avx2").
+ */
+const char* base64_backend_name(Base64Backend backend);
+
+// Characters needed to base64-encode byte_count bytes, padding included
+constexpr size_t base64_encoded_size(size_t byte_count) {
+    return (byte_count + 2) / 3 * 4;
+}
+
+/**
+ * Write the padded base64 encoding of bytes into a preallocated buffer.
+ * Exactly base64_encoded_size(bytes.size()) characters are written; no terminator.
+ *
+ * Encoding a large payload piecewise gives the same text as encoding it at once
+ * as long as every piece but the last is a multiple of 3 bytes.
+ *
+ * @param bytes Bytes to encode
+ * @param out Destination, at least base64_encoded_size(bytes.size()) characters
+ */
+void base64_encode_into(ByteSpan bytes, char* out) noexcept;
+
+/**
+ * Same as base64_encode_into() with a specific backend.
+ * An unavailable backend falls back to Portable.
+ */
+void base64_encode_into(ByteSpan bytes, char* out, Base64Backend backend) noexcept;
+
+/**
+ * Encode bytes to a padded base64 string.
+ *
+ * @param bytes Bytes to encode
+ * @return Base64 string of length base64_encoded_size(bytes.size())
+ */
+std::string base64_encode(ByteSpan bytes);
+
+/**
+ * Incremental base64 decoder.
+ *
+ * Feed the text with update() in chunks of any size, split anywhere (even
+ * inside a 4-character group), then call finish(). ASCII whitespace is skipped
+ * wherever it appears. Padding is required and ends the input: only whitespace
+ * may follow the group that carries it.
+ *
+ * Runs of the base64 alphabet are validated and converted a whole vector at a
+ * time; whitespace, padding and group remainders take the scalar path. At most
+ * three characters are carried between chunks, so decoding a large payload
+ * needs no buffer beyond each chunk's output.
+ */
+class Base64Decoder {
+public:
+    // Uses the fastest backend on this machine
+    Base64Decoder() noexcept;
+
+    // An unavailable backend falls back to Portable
+    explicit Base64Decoder(Base64Backend backend) noexcept;
+
+    // Output space that always suffices for one update() call
+    static constexpr size_t max_output_size(size_t chunk_size) {
+        return (chunk_size + 3) / 4 * 3;
+    }
+
+    /**
+     * Decode the next chunk of text.
+     *
+     * @param chunk Next piece of the base64 text
+     * @param out Destination; max_output_size(chunk.size()) bytes always suffice
+     * @return Result containing the number of bytes written, InvalidBase64Encoding
+     *         for invalid text (position counted from the start of the stream), or
+     *         MismatchedLength if out is too small. The decoder must be reset()
+     *         after an error.
+     */
+    Result<size_t> update(std::string_view chunk, MutableByteSpan out);
+
+    /**
+     * Check that the text ended on a group boundary.
+     *
+     * @return Result indicating success, or InvalidBase64Encoding for an incomplete group
+     */
+    Result<void> finish() const;
+
+    // Start a new stream
+    void reset() noexcept;
+
+private:
+    Base64Backend backend_;
+    uint32_t group_;        // Sextets of the current group, most recent in the low bits
+    uint8_t group_len_;     // Characters of the current group seen so far, padding included
+    uint8_t padding_;       // '=' characters in the current group
+    bool ended_;            // A padded group has been completed
+    uint64_t position_;     // Characters consumed so far, for error messages
+};
+
+/**
+ * Decode base64 into a preallocated buffer (same rules as Base64Decoder).
+ *
+ * @param base64 Base64 text
+ * @param out Destination; base64.size() / 4 * 3 bytes always suffice
+ * @return Result containing the number of bytes written or error
+ */
+Result<size_t> base64_decode_into(std::string_view base64, MutableByteSpan out);
+
+/**
+ * Same as base64_decode_into() with a specific backend.
+ * An unavailable backend falls back to Portable.
+ */
+Result<size_t> base64_decode_into(std::string_view base64, MutableByteSpan out,
+                                  Base64Backend backend);
+
+/**
+ * Decode base64 into a new buffer (same rules as Base64Decoder).
+ *
+ * @param base64 Base64 text
+ * @return Result containing the decoded bytes or error
+ */
+Result<std::vector<uint8_t>> base64_decode(std::string_view base64);
+
+} // namespace pqc_ledger::codec
@@ -1,7 +1,10 @@
 #pragma once
 
 #include "../types.hpp"
+#include "../basic_transaction.hpp"
 #include "../error.hpp"
+#include "../span.hpp"
+#include <memory_resource>
 #include <vector>
 #include <cstdint>
 
@@ -24,6 +27,68 @@ namespace pqc_ledger::codec {
  */
 Result<Transaction> decode(const std::vector<uint8_t>& data);
 
+/**
+ * Strictly decode a transaction without copying it.
+ * 
+ * Applies exactly the same rules as decode(), but the returned view
+ * references the public key and signatures in place. Call
+ * TransactionView::to_transaction() to obtain an owning copy.
+ * 
+ * @param data Binary data to decode (must outlive the returned view)
+ * @param size Size of data in bytes
+ * @return Result containing the transaction view or error
+ */
+Result<TransactionView> decode_view(const uint8_t* data, size_t size);
+
+/**
+ * Non-throwing, non-allocating variant of decode_view().
+ * 
+ * Rejection costs no more than the bytes inspected: no exception, no
+ * heap allocation and no message formatting. Intended for admission paths
+ * that only need the error code.
+ * 
+ * @param data Binary data to decode (must outlive the view)
+ * @param size Size of data in bytes
+ * @param out Receives the decoded view on success (unspecified on failure)
+ * @param error Receives the error code on failure
+ * @return true if the transaction decoded successfully
+ */
+bool try_decode_view(const uint8_t* data, size_t size, TransactionView& out,
+                     ErrorCode& error) noexcept;
+
+/**
+ * Strictly decode a transaction into memory from the given resource.
+ * 
+ * Applies exactly the same rules as decode(). On success the encoded bytes are
+ * copied into a single allocation from resource and the returned view points
+ * there, so the input buffer may be released. With a per-block
+ * std::pmr::monotonic_buffer_resource, a whole block of transactions is freed
+ * in one operation and decoding never touches the shared heap. Rejected
+ * inputs allocate nothing.
+ * 
+ * @param data Binary data to decode
+ * @param resource Memory resource that must outlive the returned view
+ * @return Result containing the transaction view (signed_bytes included) or error
+ */
+Result<TransactionView> decode_into(ByteSpan data, std::pmr::memory_resource* resource);
+
+/**
+ * Strictly decode a signed transaction into its fixed-size form.
+ * 
+ * Accepts exactly the signed encodings decode() accepts for Params. Every
+ * length prefix of such an encoding is a known constant, so the fields are
+ * checked and copied at fixed offsets; malformed input falls back to the
+ * general decoder to report the same error code decode() would. Unsigned
+ * encodings (empty PQ signature) are rejected with InvalidSignature.
+ * Instantiated for crypto::MlDsa44, MlDsa65 and MlDsa87.
+ * 
+ * @param data Binary data to decode
+ * @param out Receives the transaction (unspecified on failure)
+ * @return Result indicating success or error
+ */
+template<typename Params>
+Result<void> decode(ByteSpan data, BasicTransaction<Params>& out);
+
 /**
  * Decode from hex string.
  * 
@@ -1,7 +1,9 @@
 #pragma once
 
 #include "../types.hpp"
+#include "../basic_transaction.hpp"
 #include "../error.hpp"
+#include "../crypto/hash.hpp"
 #include <vector>
 #include <cstdint>
 
@@ -21,6 +23,64 @@ namespace pqc_ledger::codec {
  */
 Result<std::vector<uint8_t>> encode(const Transaction& tx);
 
+/**
+ * Exact number of bytes encode() produces for a transaction.
+ * 
+ * @param tx Transaction to measure
+ * @return Encoded size in bytes
+ */
+size_t encoded_size(const Transaction& tx);
+
+/**
+ * Encode a transaction into a caller-provided buffer.
+ * Nothing is written unless the transaction is encodable and fits.
+ * 
+ * @param tx Transaction to encode
+ * @param out Destination; must hold at least encoded_size(tx) bytes
+ * @return Result containing the number of bytes written, or error
+ */
+Result<size_t> encode_into(const Transaction& tx, MutableByteSpan out);
+
+/**
+ * Append the encoding of a transaction to a buffer.
+ * Grows the buffer once, by exactly encoded_size(tx).
+ * 
+ * @param tx Transaction to encode
+ * @param out Buffer to append to (left unchanged on error)
+ * @return Result indicating success or error
+ */
+Result<void> encode_append(const Transaction& tx, std::vector<uint8_t>& out);
+
+/**
+ * Wire encoding of a transaction together with its signing message.
+ */
+struct EncodedTransaction {
+    std::vector<uint8_t> bytes;  // encode(tx)
+    Hash32 sighash{};            // SHA256("TXv1" || chain_id_be || encode_for_signing(tx))
+};
+
+/**
+ * Encode a transaction and compute its signing message in one pass.
+ * The unsigned fields are written once and hashed straight from the output
+ * buffer, instead of being serialized again by encode_for_signing().
+ * 
+ * @param tx Transaction to encode
+ * @param chain_id Chain ID for domain separation of the signing message
+ * @return Result containing wire bytes and signing message, or error
+ */
+Result<EncodedTransaction> encode_with_sighash(const Transaction& tx, uint32_t chain_id);
+
+/**
+ * Append the auth tag and signature payload of a transaction to a buffer.
+ * Appending this to append_for_signing() output yields exactly encode(tx); lets a
+ * signer serialize the unsigned fields once, hash them, then add the signature.
+ * 
+ * @param tx Transaction whose auth fields to encode
+ * @param out Buffer to append to (left unchanged on error)
+ * @return Result indicating success or error
+ */
+Result<void> append_auth(const Transaction& tx, std::vector<uint8_t>& out);
+
 /**
  * Encode transaction without signatures (for signing).
  * This excludes the auth field.
@@ -30,6 +90,68 @@ Result<std::vector<uint8_t>> encode(const Transaction& tx);
  */
 Result<std::vector<uint8_t>> encode_for_signing(const Transaction& tx);
 
+/**
+ * Append the signing encoding of a transaction to a buffer.
+ * Appends exactly the bytes encode_for_signing() would return; lets callers pack
+ * many encodings into one allocation.
+ * 
+ * @param tx Transaction to encode (signatures are ignored)
+ * @param out Buffer to append to (left unchanged on error)
+ * @return Result indicating success or error
+ */
+Result<void> append_for_signing(const Transaction& tx, std::vector<uint8_t>& out);
+
+/**
+ * Stream the signing encoding of a transaction into a hasher.
+ * Feeds exactly the bytes encode_for_signing() would return, without building them.
+ * 
+ * @param tx Transaction to encode (signatures are ignored)
+ * @param hasher Hasher to feed
+ * @return Result indicating success or error
+ */
+Result<void> hash_for_signing(const Transaction& tx, crypto::Sha256& hasher);
+
+/**
+ * Stream the full encoding of a transaction into a hasher.
+ * Feeds exactly the bytes encode() would return, without building them.
+ * 
+ * @param tx Transaction to encode
+ * @param hasher Hasher to feed
+ * @return Result indicating success or error
+ */
+Result<void> hash_encoded(const Transaction& tx, crypto::Sha256& hasher);
+
+/**
+ * Encode a fixed-size transaction into a caller-provided buffer.
+ * Produces the same bytes as encode(tx.to_transaction()), written at constant offsets.
+ * Instantiated for crypto::MlDsa44, MlDsa65 and MlDsa87.
+ * 
+ * @param tx Transaction to encode
+ * @param out Destination; must hold at least tx.encoded_size() bytes
+ * @return Result containing the number of bytes written, or error
+ */
+template<typename Params>
+Result<size_t> encode_into(const BasicTransaction<Params>& tx, MutableByteSpan out);
+
+/**
+ * Encode a fixed-size transaction.
+ * 
+ * @param tx Transaction to encode
+ * @return Result containing encoded bytes or error
+ */
+template<typename Params>
+Result<std::vector<uint8_t>> encode(const BasicTransaction<Params>& tx);
+
+/**
+ * Stream the signing encoding of a fixed-size transaction into a hasher.
+ * Cannot fail: every field has its final size.
+ * 
+ * @param tx Transaction to encode (signatures are ignored)
+ * @param hasher Hasher to feed
+ */
+template<typename Params>
+void hash_for_signing(const BasicTransaction<Params>& tx, crypto::Sha256& hasher);
+
 /**
  * Encode bytes to hex string.
  * 
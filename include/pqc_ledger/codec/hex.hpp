@@ -0,0 +1,99 @@
+#pragma once
+
+#include "../error.hpp"
+#include "../span.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace pqc_ledger::codec {
+
+/**
+ * Hex codec implementations. hex_backend() picks the fastest one the CPU
+ * supports; the others can be requested explicitly (tests, benchmarks).
+ * All backends produce identical output and report identical errors.
+ */
+enum class HexBackend : uint8_t {
+    Portable,  // Table-driven scalar C++, always available
+    Ssse3,     // 16 bytes per step with pshufb / pmaddubsw
+    Avx2,      // 32 bytes per step
+};
+
+/**
+ * Backend used by the hex functions on this machine.
+ * Preference: Avx2, then Ssse3, then Portable.
+ */
+HexBackend hex_backend();
+
+/**
+ * Check whether a backend can run on this machine and build.
+ */
+bool hex_backend_available(HexBackend backend);
+
+/**
+ * Short backend name for logs and benchmark labels (e.g. "avx2").
+ */
+const char* hex_backend_name(HexBackend backend);
+
+// Characters needed to hex-encode byte_count bytes
+constexpr size_t hex_encoded_size(size_t byte_count) {
+    return byte_count * 2;
+}
+
+/**
+ * Write the lowercase hex encoding of bytes into a preallocated buffer.
+ * Exactly hex_encoded_size(bytes.size()) characters are written; no terminator.
+ *
+ * @param bytes Bytes to encode
+ * @param out Destination, at least hex_encoded_size(bytes.size()) characters
+ */
+void hex_encode_into(ByteSpan bytes, char* out) noexcept;
+
+/**
+ * Same as hex_encode_into() with a specific backend.
+ * An unavailable backend falls back to Portable.
+ */
+void hex_encode_into(ByteSpan bytes, char* out, HexBackend backend) noexcept;
+
+/**
+ * Encode bytes to a lowercase hex string.
+ *
+ * @param bytes Bytes to encode
+ * @return Hex string of length hex_encoded_size(bytes.size())
+ */
+std::string hex_encode(ByteSpan bytes);
+
+/**
+ * Decode hex into a preallocated buffer.
+ *
+ * Digits may be upper or lower case. ASCII whitespace is skipped anywhere,
+ * including between the two digits of a byte, so wrapped or grouped input
+ * decodes without first being copied. Runs of digits are validated and
+ * converted a whole vector at a time; whitespace and the tail take the scalar
+ * path.
+ *
+ * @param hex Hex text
+ * @param out Destination; hex.size() / 2 bytes always suffice
+ * @return Result containing the number of bytes written, InvalidHexEncoding for
+ *         an invalid character or an odd number of digits, or MismatchedLength
+ *         if out is too small
+ */
+Result<size_t> hex_decode_into(std::string_view hex, MutableByteSpan out);
+
+/**
+ * Same as hex_decode_into() with a specific backend.
+ * An unavailable backend falls back to Portable.
+ */
+Result<size_t> hex_decode_into(std::string_view hex, MutableByteSpan out, HexBackend backend);
+
+/**
+ * Decode hex into a new buffer (same rules as hex_decode_into()).
+ *
+ * @param hex Hex text
+ * @return Result containing the decoded bytes or error
+ */
+Result<std::vector<uint8_t>> hex_decode(std::string_view hex);
+
+} // namespace pqc_ledger::codec
@@ -0,0 +1,42 @@
+#pragma once
+
+#include "../types.hpp"
+#include "../error.hpp"
+#include "../span.hpp"
+#include <cstdint>
+
+namespace pqc_ledger::codec {
+
+/**
+ * Scalar fields of an encoded transaction, read in place.
+ */
+struct TransactionHeader {
+    uint8_t version = 0;
+    uint32_t chain_id = 0;
+    uint64_t nonce = 0;
+    Address to{};
+    uint64_t amount = 0;
+    uint64_t fee = 0;
+    uint8_t auth_tag = 0;  // Raw tag byte; not checked against the known auth modes
+};
+
+/**
+ * Read the scalar fields of an encoded transaction without decoding it.
+ * 
+ * With the default parameter set's public key length, every field up to and
+ * including the auth tag sits at a constant offset. peek() checks that the
+ * buffer reaches the auth tag and that the public key length prefix has that
+ * value, then loads the fields. Nothing after the auth tag is inspected, so
+ * a successful peek does not mean the transaction decodes.
+ * 
+ * Never throws or allocates.
+ * 
+ * @param wire Encoded transaction
+ * @param out Receives the fields on success (unspecified on failure)
+ * @param error Receives InvalidLengthPrefix (too short) or InvalidPublicKey
+ *              (unexpected key length) on failure
+ * @return true if the fields were read
+ */
+bool peek(ByteSpan wire, TransactionHeader& out, ErrorCode& error) noexcept;
+
+} // namespace pqc_ledger::codec
@@ -0,0 +1,195 @@
+#pragma once
+
+#include "../types.hpp"
+#include "../error.hpp"
+#include "../span.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace pqc_ledger::codec {
+
+/**
+ * Transaction stream format.
+ *
+ * A stream is an 8-byte header followed by records:
+ *
+ *   header: "PQTS" | version u8 (= 1) | flags u8 | reserved u16 (= 0)
+ *   record: length u32 | payload (length bytes) | crc32c u32 (if flagged)
+ *
+ * Integers are big-endian like the transaction encoding. Flag bit 0 means
+ * every record carries a CRC32C of its payload; no other flags are defined.
+ * The payload of a transaction record is its canonical encoding (encode()).
+ * Records are self-delimiting, so streams can be concatenated record-wise
+ * (not header-wise) and read without an index.
+ */
+constexpr size_t TX_STREAM_HEADER_SIZE = 8;
+constexpr uint8_t TX_STREAM_VERSION = 1;
+constexpr uint8_t TX_STREAM_FLAG_CHECKSUMS = 0x01;
+
+// Default cap on a record's payload; a hybrid ML-DSA-87 transaction is under 8 KB
+constexpr size_t TX_STREAM_DEFAULT_MAX_RECORD = 1 << 20;
+
+/**
+ * CRC32C (Castagnoli polynomial, as in iSCSI and ext4) of data.
+ * Uses the SSE4.2 crc32 instruction when available.
+ *
+ * @param data Bytes to checksum
+ * @param crc CRC of the preceding bytes, to checksum a message in pieces
+ * @return CRC32C of everything checksummed so far
+ */
+uint32_t crc32c(ByteSpan data, uint32_t crc = 0) noexcept;
+
+/**
+ * Pull-style byte source: fills a prefix of out and returns how many bytes it
+ * wrote, 0 once the input is exhausted.
+ */
+using ByteSource = std::function<Result<size_t>(MutableByteSpan out)>;
+
+/**
+ * Push-style byte sink: consumes all of data or fails.
+ */
+using ByteSink = std::function<Result<void>(ByteSpan data)>;
+
+// Source reading a file descriptor (read(2), retried on EINTR); the fd is not closed
+ByteSource fd_source(int fd);
+
+// Sink writing a file descriptor (write(2), retried on EINTR and short writes)
+ByteSink fd_sink(int fd);
+
+// Sink appending to a vector, which must outlive the sink
+ByteSink vector_sink(std::vector<uint8_t>& out);
+
+struct TxStreamReaderOptions {
+    // Larger records are rejected as corrupt before anything is allocated for them
+    size_t max_record_size = TX_STREAM_DEFAULT_MAX_RECORD;
+
+    // Read size for ByteSource input. The buffer only grows beyond this to hold
+    // a single record that does not fit, and never beyond one maximum-size record.
+    size_t buffer_size = 64 * 1024;
+};
+
+/**
+ * Incremental reader for the transaction stream format.
+ *
+ * Constructed over a memory region (a buffer, or a file mapped with mmap),
+ * it hands out records in place without copying. Constructed over a
+ * ByteSource (a pipe, socket or file descriptor), it reads through one
+ * bounded buffer, so memory use does not depend on the stream's length.
+ *
+ * Spans and views returned by next_record()/next() borrow from the region or
+ * the buffer and stay valid until the following call. After an error the
+ * reader is positioned at the offending record and should be discarded.
+ */
+class TxStreamReader {
+public:
+    explicit TxStreamReader(ByteSpan data, const TxStreamReaderOptions& options = {});
+    explicit TxStreamReader(ByteSource source, const TxStreamReaderOptions& options = {});
+
+    /**
+     * Read the next record's payload.
+     *
+     * @param payload Receives the payload on success
+     * @return Result containing true for a record, false at the clean end of the
+     *         stream; InvalidStreamHeader, InvalidLengthPrefix (zero, oversized or
+     *         truncated record), ChecksumMismatch, or the source's error
+     */
+    Result<bool> next_record(ByteSpan& payload);
+
+    /**
+     * Read and strictly decode the next transaction (as decode_view()).
+     *
+     * @param out Receives the transaction on success
+     * @return Result containing true for a transaction, false at the clean end of
+     *         the stream, or error
+     */
+    Result<bool> next(TransactionView& out);
+
+    // Records returned so far
+    uint64_t records_read() const { return records_read_; }
+
+    // Stream offset of the next record (bytes consumed so far, header included)
+    uint64_t offset() const { return offset_; }
+
+    // Whether records carry checksums; meaningful once the header has been read
+    bool checksums() const { return checksums_; }
+
+private:
+    Result<bool> fill(size_t count);
+    Result<void> read_header();
+
+    ByteSource source_;             // Empty when reading a memory region
+    std::vector<uint8_t> buffer_;   // ByteSource input only
+    const uint8_t* data_;           // Region or buffer_.data()
+    size_t begin_;                  // Unconsumed bytes are [begin_, end_) of data_
+    size_t end_;
+    bool source_done_;
+    TxStreamReaderOptions options_;
+    bool header_read_;
+    bool checksums_;
+    uint64_t records_read_;
+    uint64_t offset_;
+};
+
+struct TxStreamWriterOptions {
+    // Append a CRC32C to every record
+    bool checksums = true;
+
+    // Bytes collected before they are handed to the sink
+    size_t buffer_size = 64 * 1024;
+};
+
+/**
+ * Buffered writer for the transaction stream format.
+ *
+ * Records are encoded straight into the output buffer, which goes to the sink
+ * whenever the next record would not fit and on flush(). The header is part of
+ * the first flush, so even an empty stream is well formed.
+ *
+ * The destructor flushes but cannot report failure; call flush() before
+ * destroying the writer to see errors.
+ */
+class TxStreamWriter {
+public:
+    explicit TxStreamWriter(ByteSink sink, const TxStreamWriterOptions& options = {});
+    ~TxStreamWriter();
+
+    TxStreamWriter(const TxStreamWriter&) = delete;
+    TxStreamWriter& operator=(const TxStreamWriter&) = delete;
+
+    /**
+     * Append a transaction record.
+     *
+     * @param tx Transaction to encode
+     * @return Result indicating success, the encoder's error (nothing is written),
+     *         or the sink's error
+     */
+    Result<void> write(const Transaction& tx);
+
+    /**
+     * Append a record with an already encoded payload.
+     *
+     * @param payload Record payload (1 byte to 4 GiB - 1)
+     * @return Result indicating success or error
+     */
+    Result<void> write_record(ByteSpan payload);
+
+    // Hand everything buffered to the sink
+    Result<void> flush();
+
+    // Records accepted so far (buffered or flushed)
+    uint64_t records_written() const { return records_written_; }
+
+private:
+    // Reserve room for a record of payload_size; returns its start in buffer_
+    Result<size_t> begin_record(size_t payload_size);
+    void end_record(size_t start, size_t payload_size);
+
+    ByteSink sink_;
+    TxStreamWriterOptions options_;
+    std::vector<uint8_t> buffer_;
+    uint64_t records_written_;
+};
+
+} // namespace pqc_ledger::codec
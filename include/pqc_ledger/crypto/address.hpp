@@ -14,6 +14,16 @@ namespace pqc_ledger::crypto {
  */
 Result<Address> derive_address(const PublicKey& pubkey);
 
+/**
+ * Derive addresses for many public keys at once.
+ * Uses multi-buffer SHA-256 (sha256_many), which pays off for equal-size keys.
+ * 
+ * @param pubkeys Public key bytes
+ * @param addresses Receives one address per key (same size as pubkeys)
+ * @return Result indicating success or error
+ */
+Result<void> derive_addresses(Span<const ByteSpan> pubkeys, Span<Address> addresses);
+
 /**
  * Convert address to hex string.
  * 
@@ -55,7 +55,7 @@ Result<void> save_ed25519_private_key(const std::vector<uint8_t>& privkey, const
  * @param privkey Private key (32 bytes)
  * @return Result containing signature (64 bytes) or error
  */
-Result<Signature> ed25519_sign(const std::vector<uint8_t>& message,
+Result<Signature> ed25519_sign(ByteSpan message,
                                 const std::vector<uint8_t>& privkey);
 
 /**
@@ -66,9 +66,9 @@ Result<Signature> ed25519_sign(const std::vector<uint8_t>& message,
  * @param pubkey Public key (32 bytes)
  * @return Result<bool> - true if valid, false if invalid, or error
  */
-Result<bool> ed25519_verify(const std::vector<uint8_t>& message,
-                            const Signature& signature,
-                            const PublicKey& pubkey);
+Result<bool> ed25519_verify(ByteSpan message,
+                            ByteSpan signature,
+                            ByteSpan pubkey);
 
 } // namespace pqc_ledger::crypto
 
@@ -2,19 +2,145 @@
 
 #include "../error.hpp"
 #include "../types.hpp"
+#include <array>
 #include <vector>
 #include <string>
 #include <cstdint>
 
 namespace pqc_ledger::crypto {
 
+/**
+ * SHA-256 implementations. The fastest one available is picked at startup from
+ * cpuid; the others can be requested explicitly (tests, benchmarks).
+ */
+enum class Sha256Backend : uint8_t {
+    Portable,  // Scalar C++, always available
+    ShaNi,     // x86 SHA extensions
+    OpenSsl,   // OpenSSL EVP (one-shot hashing only; has its own SIMD dispatch)
+    Avx2       // Eight messages at once in AVX2 lanes (sha256_many only)
+};
+
+/**
+ * Backend used by sha256() and address derivation on this machine.
+ * Preference: ShaNi, then OpenSsl (when built with OpenSSL), then Portable.
+ */
+Sha256Backend sha256_backend();
+
+/**
+ * Check whether a backend can run on this machine and build.
+ */
+bool sha256_backend_available(Sha256Backend backend);
+
+/**
+ * Short backend name for logs and benchmark labels (e.g. "sha-ni").
+ */
+const char* sha256_backend_name(Sha256Backend backend);
+
+/**
+ * Incremental SHA-256 hasher.
+ * 
+ * Feed data with update() in as many pieces as convenient, then call final()
+ * once. Nothing is buffered beyond one 64-byte block, so hashing a message
+ * built from several fields needs no concatenation buffer. Copying a hasher
+ * snapshots its state.
+ */
+class Sha256 {
+public:
+    static constexpr size_t DIGEST_SIZE = 32;
+    static constexpr size_t BLOCK_SIZE = 64;
+    
+    // Uses the fastest block function on this machine
+    Sha256() noexcept;
+    
+    // Uses the given backend's block function. OpenSsl and Avx2 have no single-stream
+    // block function, so they (like an unavailable backend) fall back to the default.
+    explicit Sha256(Sha256Backend backend) noexcept;
+    
+    // Restart hashing from the empty message
+    void reset() noexcept;
+    
+    Sha256& update(const uint8_t* data, size_t size) noexcept;
+    Sha256& update(ByteSpan data) noexcept { return update(data.data(), data.size()); }
+    
+    // Finish hashing; the hasher must be reset() before it is reused
+    Hash32 final() noexcept;
+    
+private:
+    void (*compress_)(uint32_t state[8], const uint8_t* blocks, size_t num_blocks);
+    uint32_t state_[8];
+    uint8_t buffer_[BLOCK_SIZE];
+    size_t buffer_len_;
+    uint64_t total_len_;
+};
+
+// Size of the signing-message domain prefix, "TXv1" || chain_id_be
+constexpr size_t SIGNING_PREFIX_SIZE = 8;
+
+/**
+ * Domain prefix of a signing message: "TXv1" || chain_id_be.
+ * For callers that lay signing bytes out themselves; begin_signing_message()
+ * absorbs the same bytes.
+ * 
+ * @param chain_id Chain ID (big-endian)
+ * @return The 8 prefix bytes
+ */
+std::array<uint8_t, SIGNING_PREFIX_SIZE> signing_message_prefix(uint32_t chain_id);
+
+/**
+ * Start a domain-separated signing message.
+ * Returns a hasher that has already absorbed "TXv1" || chain_id_be; feed it the
+ * canonical encoding of the transaction without signatures and call final().
+ * 
+ * @param chain_id Chain ID (big-endian)
+ * @return Hasher primed with the domain prefix
+ */
+Sha256 begin_signing_message(uint32_t chain_id);
+
 /**
  * Compute SHA256 hash of data.
  * 
  * @param data Input data to hash
  * @return Result containing 32-byte hash or error
  */
-Result<std::vector<uint8_t>> sha256(const std::vector<uint8_t>& data);
+Result<Hash32> sha256(ByteSpan data);
+
+/**
+ * Compute SHA256 hash of data with a specific backend.
+ * 
+ * @param data Input data to hash
+ * @param backend Implementation to use
+ * @return Result containing 32-byte hash, or HashError if the backend is unavailable
+ */
+Result<Hash32> sha256(ByteSpan data, Sha256Backend backend);
+
+/**
+ * Backend used by sha256_many() on this machine: Avx2 when the single-stream
+ * backend is Portable (eight scalar lanes lose to one SHA-NI or OpenSSL stream),
+ * otherwise sha256_backend().
+ */
+Sha256Backend sha256_many_backend();
+
+/**
+ * Compute SHA256 of many independent messages.
+ * Multi-buffer backends hash several messages per instruction stream; they work
+ * best when the messages have (nearly) the same length.
+ * 
+ * @param inputs Messages to hash
+ * @param outputs Receives one digest per message (same size as inputs)
+ * @return Result indicating success, or HashError on a size mismatch
+ */
+Result<void> sha256_many(Span<const ByteSpan> inputs, Span<Hash32> outputs);
+
+/**
+ * Compute SHA256 of many independent messages with a specific backend.
+ * 
+ * @param inputs Messages to hash
+ * @param outputs Receives one digest per message (same size as inputs)
+ * @param backend Implementation to use
+ * @return Result indicating success, or HashError on a size mismatch or unavailable backend
+ */
+Result<void> sha256_many(Span<const ByteSpan> inputs, Span<Hash32> outputs,
+                         Sha256Backend backend);
 
 /**
  * Compute SHA256 hash of multiple byte vectors concatenated.
@@ -22,7 +148,7 @@ Result<std::vector<uint8_t>> sha256(const std::vector<uint8_t>& data);
  * @param parts Vector of byte vectors to concatenate and hash
  * @return Result containing 32-byte hash or error
  */
-Result<std::vector<uint8_t>> sha256_concat(const std::vector<std::vector<uint8_t>>& parts);
+Result<Hash32> sha256_concat(const std::vector<std::vector<uint8_t>>& parts);
 
 /**
  * Create domain-separated signing message.
@@ -32,8 +158,7 @@ Result<std::vector<uint8_t>> sha256_concat(const std::vector<std::vector<uint8_t
  * @param tx_data Canonically encoded transaction (without signatures)
  * @return Result containing 32-byte message hash or error
  */
-Result<std::vector<uint8_t>> create_signing_message(uint32_t chain_id, 
-                                                     const std::vector<uint8_t>& tx_data);
+Result<Hash32> create_signing_message(uint32_t chain_id, ByteSpan tx_data);
 
 } // namespace pqc_ledger::crypto
 
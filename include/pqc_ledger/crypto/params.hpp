@@ -0,0 +1,88 @@
+#pragma once
+
+#include "../types.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace pqc_ledger::crypto {
+
+/**
+ * Supported post-quantum signature algorithms.
+ * ML-DSA is the NIST standard name for the Dilithium family.
+ */
+enum class PqAlgorithm : uint8_t {
+    MlDsa44 = 0,  // Dilithium2
+    MlDsa65 = 1,  // Dilithium3 (default)
+    MlDsa87 = 2   // Dilithium5
+};
+
+/**
+ * Compile-time ML-DSA parameter sets (FIPS 204 sizes).
+ * 
+ * These are the sizes the wire format is pinned to. The codec and the cheap
+ * validation checks use them directly, so parsing never touches liboqs; the
+ * algorithm registry checks them against liboqs once at start-up.
+ */
+struct MlDsa44 {
+    static constexpr PqAlgorithm algorithm = PqAlgorithm::MlDsa44;
+    static constexpr const char* name = "ML-DSA-44";
+    static constexpr size_t pubkey_size = 1312;
+    static constexpr size_t secret_key_size = 2560;
+    static constexpr size_t signature_size = 2420;
+};
+
+struct MlDsa65 {
+    static constexpr PqAlgorithm algorithm = PqAlgorithm::MlDsa65;
+    static constexpr const char* name = "ML-DSA-65";
+    static constexpr size_t pubkey_size = 1952;
+    static constexpr size_t secret_key_size = 4032;
+    static constexpr size_t signature_size = 3309;
+};
+
+struct MlDsa87 {
+    static constexpr PqAlgorithm algorithm = PqAlgorithm::MlDsa87;
+    static constexpr const char* name = "ML-DSA-87";
+    static constexpr size_t pubkey_size = 2592;
+    static constexpr size_t secret_key_size = 4896;
+    static constexpr size_t signature_size = 4627;
+};
+
+// Parameter set used by the transaction format
+using DefaultPqParams = MlDsa65;
+
+static_assert(DefaultPqParams::pubkey_size == PQ_PUBKEY_SIZE, "PQ_PUBKEY_SIZE out of sync");
+static_assert(DefaultPqParams::signature_size == PQ_SIG_SIZE, "PQ_SIG_SIZE out of sync");
+
+/**
+ * Runtime-indexable view of the parameter sets.
+ */
+struct PqParams {
+    PqAlgorithm algorithm;
+    const char* name;
+    size_t pubkey_size;
+    size_t secret_key_size;
+    size_t signature_size;
+};
+
+template<typename Params>
+constexpr PqParams make_pq_params() {
+    return PqParams{Params::algorithm, Params::name, Params::pubkey_size,
+                    Params::secret_key_size, Params::signature_size};
+}
+
+// Indexed by PqAlgorithm
+constexpr std::array<PqParams, 3> PQ_PARAMS = {
+    make_pq_params<MlDsa44>(),
+    make_pq_params<MlDsa65>(),
+    make_pq_params<MlDsa87>(),
+};
+
+constexpr const PqParams& pq_params(PqAlgorithm algorithm) {
+    return PQ_PARAMS[static_cast<size_t>(algorithm)];
+}
+
+static_assert(pq_params(PqAlgorithm::MlDsa65).signature_size == MlDsa65::signature_size,
+              "PQ_PARAMS must be indexed by PqAlgorithm");
+
+} // namespace pqc_ledger::crypto
@@ -2,12 +2,62 @@
 
 #include "../error.hpp"
 #include "../types.hpp"
+#include "params.hpp"
 #include <string>
 #include <vector>
 #include <cstdint>
 
+// liboqs signature context (defined in <oqs/oqs.h>, kept out of public headers)
+struct OQS_SIG;
+
 namespace pqc_ledger::crypto {
 
+/**
+ * Immutable per-algorithm descriptor handed out by the algorithm registry.
+ * 
+ * The registry creates one liboqs context per algorithm the first time it is
+ * used (thread-safe) and keeps it for the lifetime of the process, so
+ * descriptors can be shared across threads and sign/verify never allocate
+ * a context per call.
+ */
+struct PqAlgorithmDescriptor {
+    PqAlgorithm algorithm;     // Requested algorithm
+    const char* oqs_name;      // liboqs method name backing this descriptor
+    const OQS_SIG* context;    // Shared liboqs context (sizes + function pointers)
+    size_t pubkey_size;
+    size_t secret_key_size;
+    size_t signature_size;
+    bool is_fallback;          // true if another ML-DSA level stands in for an unavailable one
+};
+
+/**
+ * Map an algorithm name to its enum value.
+ * Accepts ML-DSA names and the legacy Dilithium names ("Dilithium3", "Dilithium-3", ...).
+ * 
+ * @param algorithm Algorithm name
+ * @return Result containing the algorithm or error
+ */
+Result<PqAlgorithm> parse_algorithm(const std::string& algorithm);
+
+/**
+ * Look up the registry descriptor for an algorithm.
+ * The returned pointer stays valid for the lifetime of the process.
+ * 
+ * @param algorithm Algorithm to look up
+ * @return Result containing the descriptor, or error if no ML-DSA algorithm is available
+ */
+Result<const PqAlgorithmDescriptor*> get_algorithm(PqAlgorithm algorithm);
+
+/**
+ * Check the compile-time parameter table (params.hpp) against the linked liboqs.
+ * 
+ * The registry only accepts liboqs contexts whose sizes match the table, so a
+ * mismatch means the affected algorithm is served by a fallback (or not at all).
+ * 
+ * @return Result indicating success, or error naming the first mismatching algorithm
+ */
+Result<void> check_pq_params();
+
 /**
  * Generate a post-quantum key pair.
  * Uses Dilithium3 by default.
@@ -16,6 +66,7 @@ namespace pqc_ledger::crypto {
  * @return Result containing public key and private key paths, or error
  */
 Result<std::pair<PublicKey, std::vector<uint8_t>>> generate_keypair(const std::string& algorithm = "Dilithium3");
+Result<std::pair<PublicKey, std::vector<uint8_t>>> generate_keypair(PqAlgorithm algorithm);
 
 /**
  * Load public key from file.
@@ -59,9 +110,12 @@ Result<void> save_private_key(const std::vector<uint8_t>& privkey, const std::st
  * @param algorithm Algorithm name (e.g., "Dilithium3")
  * @return Result containing signature or error
  */
-Result<Signature> sign(const std::vector<uint8_t>& message,
+Result<Signature> sign(ByteSpan message,
                        const std::vector<uint8_t>& privkey,
                        const std::string& algorithm = "Dilithium3");
+Result<Signature> sign(ByteSpan message,
+                       const std::vector<uint8_t>& privkey,
+                       PqAlgorithm algorithm);
 
 /**
  * Verify a message signature with a post-quantum public key.
@@ -72,10 +126,14 @@ Result<Signature> sign(const std::vector<uint8_t>& message,
  * @param algorithm Algorithm name (e.g., "Dilithium3")
  * @return Result<bool> - true if valid, false if invalid, or error
  */
-Result<bool> verify(const std::vector<uint8_t>& message,
-                    const Signature& signature,
-                    const PublicKey& pubkey,
+Result<bool> verify(ByteSpan message,
+                    ByteSpan signature,
+                    ByteSpan pubkey,
                     const std::string& algorithm = "Dilithium3");
+Result<bool> verify(ByteSpan message,
+                    ByteSpan signature,
+                    ByteSpan pubkey,
+                    PqAlgorithm algorithm);
 
 /**
  * Get expected public key size for algorithm.
@@ -84,6 +142,7 @@ Result<bool> verify(const std::vector<uint8_t>& message,
  * @return Result containing size in bytes or error
  */
 Result<size_t> get_pubkey_size(const std::string& algorithm);
+Result<size_t> get_pubkey_size(PqAlgorithm algorithm);
 
 /**
  * Get expected signature size for algorithm.
@@ -92,6 +151,7 @@ Result<size_t> get_pubkey_size(const std::string& algorithm);
  * @return Result containing size in bytes or error
  */
 Result<size_t> get_signature_size(const std::string& algorithm);
+Result<size_t> get_signature_size(PqAlgorithm algorithm);
 
 } // namespace pqc_ledger::crypto
 
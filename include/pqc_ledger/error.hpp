@@ -14,6 +14,10 @@ enum class ErrorCode : uint8_t {
     InvalidLengthPrefix,
     MismatchedLength,
     InvalidAuthTag,
+    InvalidStreamHeader,
+    ChecksumMismatch,
+    InvalidArchive,
+    InvalidSnapshot,
     
     // Crypto errors
     InvalidPublicKey,
@@ -28,6 +32,7 @@ enum class ErrorCode : uint8_t {
     InvalidAddress,
     InvalidAmount,
     InvalidFee,
+    RejectedByFilter,
     
     // I/O errors
     FileReadError,
@@ -4,13 +4,21 @@
 
 #include "pqc_ledger/error.hpp"
 #include "pqc_ledger/types.hpp"
+#include "pqc_ledger/basic_transaction.hpp"
+#include "pqc_ledger/span.hpp"
 
 // Codec
 #include "pqc_ledger/codec/encode.hpp"
 #include "pqc_ledger/codec/decode.hpp"
+#include "pqc_ledger/codec/peek.hpp"
+#include "pqc_ledger/codec/hex.hpp"
+#include "pqc_ledger/codec/base64.hpp"
+#include "pqc_ledger/codec/stream.hpp"
+#include "pqc_ledger/codec/archive.hpp"
 
 // Crypto
 #include "pqc_ledger/crypto/hash.hpp"
+#include "pqc_ledger/crypto/params.hpp"
 #include "pqc_ledger/crypto/pq.hpp"
 #include "pqc_ledger/crypto/address.hpp"
 #include "pqc_ledger/crypto/classical.hpp"
@@ -18,6 +26,11 @@
 // Transaction
 #include "pqc_ledger/tx/signing.hpp"
 #include "pqc_ledger/tx/validation.hpp"
+#include "pqc_ledger/tx/batch.hpp"
+#include "pqc_ledger/tx/tx_batch.hpp"
+#include "pqc_ledger/tx/verify_cache.hpp"
+#include "pqc_ledger/tx/verify_coalescer.hpp"
+#include "pqc_ledger/tx/reject_filter.hpp"
 
 // Main namespace
 namespace pqc_ledger {
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+namespace pqc_ledger {
+
+/**
+ * Non-owning view over a contiguous sequence of elements.
+ * Minimal stand-in for C++20 std::span (the library targets C++17).
+ *
+ * A Span never owns its data: the underlying buffer must outlive it.
+ */
+template<typename T>
+class Span {
+public:
+    using element_type = T;
+    using value_type = std::remove_cv_t<T>;
+    using iterator = T*;
+
+    constexpr Span() noexcept : data_(nullptr), size_(0) {}
+    constexpr Span(T* data, size_t size) noexcept : data_(data), size_(size) {}
+
+    // Any contiguous container exposing data()/size() (std::vector, std::array, Span<U>)
+    template<typename Container,
+             typename = std::enable_if_t<std::is_convertible_v<
+                 std::remove_pointer_t<decltype(std::declval<Container&>().data())> (*)[],
+                 T (*)[]>>>
+    constexpr Span(Container& container) noexcept
+        : data_(container.data()), size_(container.size()) {}
+
+    // Span<U> -> Span<const U>
+    template<typename U, typename = std::enable_if_t<std::is_convertible_v<U (*)[], T (*)[]>>>
+    constexpr Span(const Span<U>& other) noexcept : data_(other.data()), size_(other.size()) {}
+
+    constexpr T* data() const noexcept { return data_; }
+    constexpr size_t size() const noexcept { return size_; }
+    constexpr bool empty() const noexcept { return size_ == 0; }
+
+    constexpr T& operator[](size_t index) const noexcept { return data_[index]; }
+
+    constexpr iterator begin() const noexcept { return data_; }
+    constexpr iterator end() const noexcept { return data_ + size_; }
+
+    // Caller guarantees offset + count <= size()
+    constexpr Span subspan(size_t offset, size_t count) const noexcept {
+        return Span(data_ + offset, count);
+    }
+
+    constexpr Span first(size_t count) const noexcept { return Span(data_, count); }
+
+private:
+    T* data_;
+    size_t size_;
+};
+
+using ByteSpan = Span<const uint8_t>;
+using MutableByteSpan = Span<uint8_t>;
+
+} // namespace pqc_ledger
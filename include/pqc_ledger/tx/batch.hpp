@@ -0,0 +1,60 @@
+#pragma once
+
+#include "../types.hpp"
+#include "../error.hpp"
+#include "../span.hpp"
+#include "verify_cache.hpp"
+#include <vector>
+#include <cstdint>
+
+namespace pqc_ledger::tx {
+
+/**
+ * Outcome of verifying a single transaction in a batch.
+ */
+enum class VerifyStatus : uint8_t {
+    Valid,    // Signature(s) verified
+    Invalid,  // Signature(s) did not verify
+    Error     // Verification could not be performed (see VerifyOutcome::error)
+};
+
+struct VerifyOutcome {
+    VerifyStatus status = VerifyStatus::Error;
+    ErrorCode error = ErrorCode::UnknownError;  // Only meaningful when status == Error
+};
+
+/**
+ * Options for batch verification.
+ */
+struct BatchVerifyOptions {
+    // Number of worker threads including the calling thread.
+    // 0 = std::thread::hardware_concurrency()
+    size_t num_threads = 0;
+
+    // Minimum number of transactions per worker; small batches use fewer threads
+    // so that thread start-up does not dominate the verification cost.
+    size_t min_per_thread = 4;
+
+    // Verified-signature cache shared by the workers; null verifies every
+    // transaction. Must outlive the call.
+    VerifyCache* cache = nullptr;
+};
+
+/**
+ * Verify a batch of transactions in parallel.
+ *
+ * Each transaction is verified exactly as by verify_transaction(tx, chain_id)
+ * (or, with options.cache, verify_transaction(tx, chain_id, *options.cache)).
+ * Work is distributed dynamically across the worker threads, so one slow
+ * transaction does not stall a whole partition.
+ *
+ * @param txs Transactions to verify
+ * @param chain_id Expected chain ID (for domain separation)
+ * @param options Threading options
+ * @return Per-transaction outcomes, in input order
+ */
+std::vector<VerifyOutcome> verify_batch(Span<const Transaction> txs,
+                                        uint32_t chain_id,
+                                        const BatchVerifyOptions& options = {});
+
+} // namespace pqc_ledger::tx
@@ -0,0 +1,136 @@
+#pragma once
+
+#include "../types.hpp"
+#include "../span.hpp"
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace pqc_ledger::tx {
+
+/**
+ * Options for RejectFilter.
+ */
+struct RejectFilterOptions {
+    // Rejections remembered per generation; the filter rotates when one fills
+    size_t generation_size = 1 << 16;
+
+    // Bloom filter false-positive rate at a full generation
+    double false_positive_rate = 0.001;
+
+    // Failed verifications after which a sender's transactions are rejected
+    // unverified; 0 (the default) disables per-sender blocking and counting.
+    // The sender key is unauthenticated, see RejectFilter
+    uint32_t max_sender_failures = 0;
+
+    // The filter also rotates once a generation is this old; zero rotates
+    // only when a generation fills (or on rotate())
+    std::chrono::milliseconds decay_interval{std::chrono::seconds(60)};
+};
+
+/**
+ * Counters of a RejectFilter.
+ */
+struct RejectFilterStats {
+    uint64_t recorded = 0;      // Failed verifications recorded
+    uint64_t txid_hits = 0;     // Checks answered by the txid filter
+    uint64_t sender_hits = 0;   // Checks answered by a blocked sender
+    uint64_t rotations = 0;
+};
+
+/**
+ * Negative cache of transactions that failed signature verification.
+ *
+ * Replaying one invalid transaction costs an attacker nothing, but each copy
+ * passes the cheap checks and costs us a full ML-DSA verification. The filter
+ * remembers recently rejected txids in a rotating pair of bloom filters
+ * (current and previous generation), so a rejection is remembered for one to
+ * two generations, and can count failures per sender public key. Checked
+ * before signature verification (see ValidationOptions::rejects), it bounds
+ * the verifications spent on repeated garbage to about one per txid per
+ * generation, and, with sender blocking on, max_sender_failures per sender
+ * per decay period.
+ *
+ * Each rotation also halves every sender's failure count, so a sender is
+ * unblocked after a few quiet generations and the sender table stays within
+ * about twice generation_size entries.
+ *
+ * Bloom false positives reject a valid transaction without verifying it, at
+ * the configured rate, until it ages out; the bit positions are salted per
+ * filter so they cannot be aimed at a given transaction. The sender public
+ * key is not authenticated until verification succeeds, so anyone can block
+ * a sender by sending forgeries in its name; that is why sender blocking is
+ * off by default. Either way the filter's answer depends on local history,
+ * so it is for mempool admission only, never for block validation. All
+ * member functions are thread-safe.
+ */
+class RejectFilter {
+public:
+    explicit RejectFilter(const RejectFilterOptions& options = RejectFilterOptions());
+
+    RejectFilter(const RejectFilter&) = delete;
+    RejectFilter& operator=(const RejectFilter&) = delete;
+
+    /**
+     * Whether a transaction should be rejected without verifying it: its txid
+     * failed recently or its sender is blocked. Counts a hit in stats().
+     *
+     * @param txid Transaction id (codec::compute_txid())
+     * @param sender_pubkey Sender public key
+     * @return true if known bad
+     */
+    bool is_rejected(const Hash32& txid, ByteSpan sender_pubkey);
+
+    /**
+     * Record a transaction whose signature verification failed.
+     *
+     * @param txid Transaction id (codec::compute_txid())
+     * @param sender_pubkey Sender public key
+     */
+    void record(const Hash32& txid, ByteSpan sender_pubkey);
+
+    // Whether txid failed recently (may be a false positive); not counted
+    bool contains(const Hash32& txid) const;
+
+    // Failures currently counted against a sender (always 0 with blocking off)
+    uint32_t sender_failures(ByteSpan sender_pubkey) const;
+
+    // Start a new generation: forget the previous one and decay sender counts
+    void rotate();
+
+    // Forget every rejection and sender (counters are kept)
+    void clear();
+
+    RejectFilterStats stats() const;
+
+private:
+    struct Probe {
+        uint64_t h1;
+        uint64_t h2;
+    };
+
+    Probe probe(const Hash32& txid) const noexcept;
+    uint64_t sender_key(ByteSpan sender_pubkey) const noexcept;
+    bool test(const std::vector<uint64_t>& bits, const Probe& probe) const noexcept;
+    void rotate_locked();
+    void rotate_if_due_locked(std::chrono::steady_clock::time_point now);
+
+    RejectFilterOptions options_;
+    std::array<uint64_t, 4> salt_;
+    size_t bit_mask_;
+    uint32_t num_hashes_;
+
+    mutable std::mutex mutex_;
+    std::vector<uint64_t> current_;
+    std::vector<uint64_t> previous_;
+    size_t current_count_;
+    std::chrono::steady_clock::time_point generation_start_;
+    std::unordered_map<uint64_t, uint32_t> sender_failures_;
+    RejectFilterStats stats_;
+};
+
+} // namespace pqc_ledger::tx
@@ -1,12 +1,29 @@
 #pragma once
 
 #include "../types.hpp"
+#include "../basic_transaction.hpp"
 #include "../error.hpp"
+#include "../crypto/hash.hpp"
+#include "verify_cache.hpp"
+#include <array>
 #include <string>
 #include <vector>
 
 namespace pqc_ledger::tx {
 
+/**
+ * Compute the domain-separated signing message of a transaction.
+ * 
+ * Same digest as crypto::create_signing_message(chain_id, codec::encode_for_signing(tx)),
+ * but the prefix and fields are streamed straight into SHA-256 without building
+ * any intermediate buffers.
+ * 
+ * @param tx Transaction (signatures are ignored)
+ * @param chain_id Chain ID for domain separation
+ * @return Result containing the 32-byte message or error
+ */
+Result<Hash32> compute_signing_message(const Transaction& tx, uint32_t chain_id);
+
 /**
  * Sign a transaction with post-quantum key.
  * 
@@ -39,6 +56,38 @@ Result<void> sign_transaction_hybrid(Transaction& tx,
                                      const std::vector<uint8_t>& ed25519_privkey,
                                      const std::string& pq_algorithm = "Dilithium3");
 
+/**
+ * Sign a transaction with a post-quantum key and return its wire encoding.
+ * 
+ * Same result as sign_transaction() followed by codec::encode(), but the unsigned
+ * fields are serialized once: the signing message is hashed from the output
+ * buffer and the signature is appended behind them.
+ * 
+ * @param tx Transaction to sign (will be modified)
+ * @param privkey PQ private key
+ * @param algorithm PQ algorithm name (e.g., "Dilithium3")
+ * @return Result containing the encoded signed transaction, or error
+ */
+Result<std::vector<uint8_t>> sign_and_encode_transaction(Transaction& tx,
+                                                         const std::vector<uint8_t>& privkey,
+                                                         const std::string& algorithm = "Dilithium3");
+
+/**
+ * Sign a transaction in hybrid mode and return its wire encoding.
+ * Single-pass counterpart of sign_transaction_hybrid() followed by codec::encode().
+ * 
+ * @param tx Transaction to sign (will be modified)
+ * @param pq_privkey PQ private key
+ * @param ed25519_privkey Ed25519 private key
+ * @param pq_algorithm PQ algorithm name (e.g., "Dilithium3")
+ * @return Result containing the encoded signed transaction, or error
+ */
+Result<std::vector<uint8_t>> sign_and_encode_transaction_hybrid(
+    Transaction& tx,
+    const std::vector<uint8_t>& pq_privkey,
+    const std::vector<uint8_t>& ed25519_privkey,
+    const std::string& pq_algorithm = "Dilithium3");
+
 /**
  * Verify a transaction signature.
  * 
@@ -53,5 +102,126 @@ Result<void> sign_transaction_hybrid(Transaction& tx,
  */
 Result<bool> verify_transaction(const Transaction& tx, uint32_t chain_id);
 
+/**
+ * Verify a transaction signature, consulting a cache of earlier successes.
+ * Same result as verify_transaction(tx, chain_id); on a cache hit the signing
+ * message is still computed but no signature is checked, and a successful
+ * verification is added to the cache.
+ * 
+ * @param tx Transaction to verify
+ * @param chain_id Expected chain ID (for domain separation)
+ * @param cache Verified-signature cache
+ * @return Result<bool> - true if valid, false if invalid, or error
+ */
+Result<bool> verify_transaction(const Transaction& tx, uint32_t chain_id, VerifyCache& cache);
+
+/**
+ * Verify a transaction's signature(s) against an already computed signing message.
+ * This is step 3 of verify_transaction; callers that hash many transactions at
+ * once (see verify_batch) use it to skip the per-transaction hashing.
+ * 
+ * @param tx Transaction to verify
+ * @param message Signing message for the expected chain (compute_signing_message)
+ * @return Result<bool> - true if valid, false if invalid, or error
+ */
+Result<bool> verify_signatures(const Transaction& tx, const Hash32& message);
+
+/**
+ * Verify a transaction's signature(s) against an already computed signing
+ * message, consulting a cache of earlier successes (see verify_transaction).
+ * 
+ * @param tx Transaction to verify
+ * @param message Signing message for the expected chain (compute_signing_message)
+ * @param cache Verified-signature cache
+ * @return Result<bool> - true if valid, false if invalid, or error
+ */
+Result<bool> verify_signatures(const Transaction& tx, const Hash32& message, VerifyCache& cache);
+
+/**
+ * Verify an encoded transaction without materializing it.
+ * 
+ * The wire bytes are strictly decoded into a borrowing view, the signed-over
+ * region (version through fee) is hashed where it sits in the buffer, and
+ * the signature(s) are checked in place. Same result as decode() followed by
+ * verify_transaction(), for nodes that only validate and forward.
+ * 
+ * @param wire Encoded transaction
+ * @param chain_id Expected chain ID (for domain separation)
+ * @return Result<bool> - true if valid, false if invalid, or error (including decode errors)
+ */
+Result<bool> verify_encoded(ByteSpan wire, uint32_t chain_id);
+
+/**
+ * Verify an encoded transaction, consulting a cache of earlier successes.
+ * Same result as verify_encoded(wire, chain_id); block validation of
+ * transactions already admitted to the mempool only decodes and hashes.
+ * 
+ * @param wire Encoded transaction
+ * @param chain_id Expected chain ID (for domain separation)
+ * @param cache Verified-signature cache
+ * @return Result<bool> - true if valid, false if invalid, or error (including decode errors)
+ */
+Result<bool> verify_encoded(ByteSpan wire, uint32_t chain_id, VerifyCache& cache);
+
+/**
+ * Verify an already decoded transaction view.
+ * 
+ * The view must come from codec::decode_view() or codec::decode_into(), which
+ * record the signed-over bytes; views built by hand (e.g. TxBatch::view())
+ * carry none and are rejected with InvalidTransaction.
+ * 
+ * @param view Decoded transaction view
+ * @param chain_id Expected chain ID (for domain separation)
+ * @return Result<bool> - true if valid, false if invalid, or error
+ */
+Result<bool> verify_view(const TransactionView& view, uint32_t chain_id);
+
+/**
+ * Compute the signing message of a fixed-size transaction.
+ * Same digest as compute_signing_message(tx.to_transaction(), chain_id); the
+ * signed fields have a constant size, so this cannot fail.
+ * Instantiated for crypto::MlDsa44, MlDsa65 and MlDsa87 (as are the overloads below).
+ * 
+ * @param tx Transaction (signatures are ignored)
+ * @param chain_id Chain ID for domain separation
+ * @return The 32-byte message
+ */
+template<typename Params>
+Hash32 compute_signing_message(const BasicTransaction<Params>& tx, uint32_t chain_id);
+
+/**
+ * Sign a fixed-size transaction with the post-quantum key of its parameter set.
+ * 
+ * @param tx Transaction to sign (will be modified)
+ * @param privkey PQ private key for Params
+ * @return Result indicating success or error
+ */
+template<typename Params>
+Result<void> sign_transaction(BasicTransaction<Params>& tx, const std::vector<uint8_t>& privkey);
+
+/**
+ * Sign a fixed-size transaction in hybrid mode (Ed25519 + PQ).
+ * 
+ * @param tx Transaction to sign (will be modified)
+ * @param pq_privkey PQ private key for Params
+ * @param ed25519_privkey Ed25519 private key
+ * @return Result indicating success or error
+ */
+template<typename Params>
+Result<void> sign_transaction_hybrid(BasicTransaction<Params>& tx,
+                                     const std::vector<uint8_t>& pq_privkey,
+                                     const std::vector<uint8_t>& ed25519_privkey);
+
+/**
+ * Verify a fixed-size transaction.
+ * Same result as verify_transaction(tx.to_transaction(), chain_id).
+ * 
+ * @param tx Transaction to verify
+ * @param chain_id Expected chain ID (for domain separation)
+ * @return Result<bool> - true if valid, false if invalid, or error
+ */
+template<typename Params>
+Result<bool> verify_transaction(const BasicTransaction<Params>& tx, uint32_t chain_id);
+
 } // namespace pqc_ledger::tx
 
@@ -0,0 +1,156 @@
+#pragma once
+
+#include "../types.hpp"
+#include "../error.hpp"
+#include "../span.hpp"
+#include <memory_resource>
+#include <vector>
+#include <cstdint>
+
+namespace pqc_ledger::tx {
+
+/**
+ * Struct-of-arrays container for many transactions.
+ *
+ * The scalar fields live in one contiguous column each, so scans over fees,
+ * nonces or chain IDs (mempool ordering, block building) touch only those
+ * arrays. Public keys and signatures, several KB per transaction, are packed
+ * into a single arena and located through an offset index; they are read only
+ * when a transaction is actually verified or serialized.
+ *
+ * All storage comes from the memory resource given at construction. Building
+ * a block's batch on a std::pmr::monotonic_buffer_resource carves every column
+ * and the arena from one region, released at once when the resource goes away,
+ * and keeps verifier threads off the shared heap (one resource per thread).
+ * A monotonic resource never reuses freed memory, so reserve() up front.
+ *
+ * Spans returned by the accessors are invalidated by push_back() and clear().
+ */
+class TxBatch {
+public:
+    explicit TxBatch(std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+
+    /**
+     * Reserve room for count transactions of the default parameter set.
+     *
+     * @param count Expected number of transactions
+     */
+    void reserve(size_t count);
+
+    void clear();
+
+    size_t size() const { return nonces_.size(); }
+    bool empty() const { return nonces_.empty(); }
+
+    /**
+     * Append a transaction, copying its variable-length fields into the arena.
+     *
+     * @param view Decoded transaction (its buffer need not outlive the batch)
+     */
+    void push_back(const TransactionView& view);
+
+    /**
+     * Append an owning transaction.
+     * The signature(s) are taken from tx.auth, whichever alternative it holds.
+     *
+     * @param tx Transaction to copy
+     */
+    void push_back(const Transaction& tx);
+
+    // Hot scalar columns, one entry per transaction in insertion order
+    Span<const uint8_t> versions() const { return versions_; }
+    Span<const uint32_t> chain_ids() const { return chain_ids_; }
+    Span<const uint64_t> nonces() const { return nonces_; }
+    Span<const uint64_t> amounts() const { return amounts_; }
+    Span<const uint64_t> fees() const { return fees_; }
+    Span<const AuthMode> auth_modes() const { return auth_modes_; }
+    Span<const Address> recipients() const { return recipients_; }
+
+    // Cold variable-length fields of transaction index, borrowed from the arena
+    ByteSpan pubkey(size_t index) const { return field(index, 0); }
+    ByteSpan classical_sig(size_t index) const { return field(index, 1); }
+    ByteSpan pq_sig(size_t index) const { return field(index, 2); }
+
+    /**
+     * Borrowing view of one transaction (signed_bytes is left empty).
+     *
+     * @param index Transaction index (< size())
+     * @return View referencing this batch's arena
+     */
+    TransactionView view(size_t index) const;
+
+    /**
+     * Owning copy of one transaction.
+     *
+     * @param index Transaction index (< size())
+     * @return Transaction equal to the one that was appended
+     */
+    Transaction to_transaction(size_t index) const;
+
+    // Bytes currently held by the arena
+    size_t arena_size() const { return arena_.size(); }
+
+    std::pmr::memory_resource* resource() const { return arena_.get_allocator().resource(); }
+
+private:
+    // Fields per transaction in the arena: pubkey, classical signature, PQ signature
+    static constexpr size_t kFieldsPerTx = 3;
+
+    void append(uint8_t version, uint32_t chain_id, uint64_t nonce, const Address& to,
+                uint64_t amount, uint64_t fee, AuthMode auth_mode, ByteSpan pubkey,
+                ByteSpan classical_sig, ByteSpan pq_sig);
+
+    ByteSpan field(size_t index, size_t which) const {
+        size_t begin = offsets_[index * kFieldsPerTx + which];
+        size_t end = offsets_[index * kFieldsPerTx + which + 1];
+        return ByteSpan(arena_.data() + begin, end - begin);
+    }
+
+    std::pmr::vector<uint8_t> versions_;
+    std::pmr::vector<uint32_t> chain_ids_;
+    std::pmr::vector<uint64_t> nonces_;
+    std::pmr::vector<uint64_t> amounts_;
+    std::pmr::vector<uint64_t> fees_;
+    std::pmr::vector<AuthMode> auth_modes_;
+    std::pmr::vector<Address> recipients_;
+
+    // Field k of transaction i spans [offsets_[3i + k], offsets_[3i + k + 1]).
+    // Fields are stored back to back, so one offset per field plus a final end suffices.
+    std::pmr::vector<uint8_t> arena_;
+    std::pmr::vector<size_t> offsets_;
+};
+
+/**
+ * Per-item outcome of the batch decode and check passes.
+ */
+struct BatchStatus {
+    bool ok = false;
+    ErrorCode error = ErrorCode::UnknownError;  // Only meaningful when !ok
+};
+
+/**
+ * Strictly decode many encoded transactions into a batch.
+ *
+ * Each input is decoded exactly as by codec::decode(); inputs that decode
+ * are appended to out in input order, the others are skipped.
+ *
+ * @param inputs Encoded transactions
+ * @param out Batch to append to
+ * @return Per-input outcomes, in input order
+ */
+std::vector<BatchStatus> decode_batch(Span<const ByteSpan> inputs, TxBatch& out);
+
+/**
+ * Cheap validation checks over a whole batch.
+ *
+ * Applies the checks of validate_cheap_checks() column by column and reports
+ * the same error code that validate_cheap_checks() would for each transaction.
+ *
+ * @param batch Transactions to check
+ * @param expected_chain_id Expected chain ID
+ * @return Per-transaction outcomes, in batch order
+ */
+std::vector<BatchStatus> validate_cheap_checks_batch(const TxBatch& batch,
+                                                     uint32_t expected_chain_id);
+
+} // namespace pqc_ledger::tx
@@ -2,6 +2,9 @@
 
 #include "../types.hpp"
 #include "../error.hpp"
+#include "../span.hpp"
+#include "verify_cache.hpp"
+#include "reject_filter.hpp"
 
 namespace pqc_ledger::tx {
 
@@ -24,6 +27,44 @@ namespace pqc_ledger::tx {
  */
 Result<void> validate_cheap_checks(const Transaction& tx, uint32_t expected_chain_id);
 
+/**
+ * Cheap validation checks on an encoded transaction, before it is decoded.
+ * 
+ * Applies the rules of validate_cheap_checks() to the wire bytes through
+ * codec::peek(): version, chain ID, non-zero nonce, amount and fee, public
+ * key size, and the exact total length implied by the auth tag (which pins
+ * both signature sizes). Meant for admission filters that drop wrong-chain
+ * or zero-fee spam before allocating anything; transactions that pass still
+ * go through strict decoding.
+ * 
+ * Error codes match validate_cheap_checks(), with two exceptions: a wrong
+ * public key length is reported before a zero amount or fee (their offsets
+ * depend on it), and a buffer that ends before the auth tag gives
+ * InvalidLengthPrefix. A wrong total length is reported as InvalidSignature.
+ * Never throws or allocates.
+ * 
+ * @param wire Encoded transaction
+ * @param expected_chain_id Expected chain ID
+ * @param error Receives the error code on failure
+ * @return true if all checks pass
+ */
+bool precheck_raw(ByteSpan wire, uint32_t expected_chain_id, ErrorCode& error) noexcept;
+
+/**
+ * Options for validate_transaction().
+ */
+struct ValidationOptions {
+    // Verified-signature cache consulted before, and filled after, signature
+    // verification; null verifies every time. Must outlive the call.
+    VerifyCache* cache = nullptr;
+
+    // Negative cache checked before signature verification (after the
+    // verified-signature cache), and told about every failure; null verifies
+    // every time. For mempool admission only: its answers depend on local
+    // history, so block validation must leave it null. Must outlive the call.
+    RejectFilter* rejects = nullptr;
+};
+
 /**
  * Full transaction validation pipeline.
  * 
@@ -38,6 +79,26 @@ Result<void> validate_cheap_checks(const Transaction& tx, uint32_t expected_chai
  */
 Result<bool> validate_transaction(const Transaction& tx, uint32_t chain_id);
 
+/**
+ * Full transaction validation pipeline with options (see validate_transaction).
+ * 
+ * With a verified-signature cache, a transaction whose signatures verified
+ * before is valid without verifying them again. With a reject filter, a
+ * transaction not in that cache whose txid failed verification recently (or
+ * whose sender is blocked) is not verified, and the call fails with
+ * RejectedByFilter. That is not a verdict: the transaction may be a valid
+ * one hit by a bloom false positive. Failed verifications are recorded in
+ * the filter.
+ * 
+ * @param tx Transaction to validate
+ * @param chain_id Expected chain ID
+ * @param options Validation options
+ * @return Result<bool> - true if valid, false if invalid, or error
+ *         (RejectedByFilter if dropped unverified)
+ */
+Result<bool> validate_transaction(const Transaction& tx, uint32_t chain_id,
+                                  const ValidationOptions& options);
+
 /**
  * Check if transaction structure is valid.
  * 
@@ -0,0 +1,187 @@
+#pragma once
+
+#include "../types.hpp"
+#include "../error.hpp"
+#include "../span.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace pqc_ledger::util {
+class MappedFile;
+}
+
+namespace pqc_ledger::tx {
+
+class VerifyCacheSnapshot;
+
+/**
+ * Counters of a VerifyCache, summed over its shards.
+ */
+struct VerifyCacheStats {
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+    uint64_t insertions = 0;
+    uint64_t evictions = 0;
+};
+
+/**
+ * Bounded cache of signatures that have already verified.
+ *
+ * A transaction is verified on mempool admission, again when a block includes
+ * it, and again on reorg; with the cache only the first of these pays for
+ * ML-DSA. Entries are keyed by a salted SHA-256 of everything verification
+ * depends on (auth mode, signing message, public key and signature(s)), so a
+ * hit proves these exact bytes verified before. Only successes are cached:
+ * signature validity never changes, so entries need no invalidation, and
+ * invalid transactions cannot fill the cache.
+ *
+ * The salt is drawn from std::random_device per cache (or adopted from a
+ * snapshot by load()), so an attacker cannot aim keys at one shard. Keys are
+ * spread over independently locked shards; each holds capacity / num_shards
+ * keys and evicts the oldest when full.
+ * All member functions are thread-safe.
+ */
+class VerifyCache {
+public:
+    static constexpr size_t DEFAULT_CAPACITY = 1 << 16;
+    static constexpr size_t DEFAULT_SHARDS = 16;
+
+    /**
+     * @param capacity Maximum number of cached signatures (at least one per shard)
+     * @param num_shards Number of independently locked shards, rounded up to a
+     *        power of two
+     */
+    explicit VerifyCache(size_t capacity = DEFAULT_CAPACITY, size_t num_shards = DEFAULT_SHARDS);
+    ~VerifyCache();
+
+    VerifyCache(const VerifyCache&) = delete;
+    VerifyCache& operator=(const VerifyCache&) = delete;
+
+    /**
+     * Cache key of one verification.
+     *
+     * @param auth_mode Auth mode of the transaction
+     * @param message Signing message for the expected chain
+     * @param pubkey Sender public key
+     * @param classical_sig Ed25519 signature (empty for PqOnly)
+     * @param pq_sig PQ signature
+     * @return Salted 32-byte key
+     */
+    Hash32 key(AuthMode auth_mode, const Hash32& message, ByteSpan pubkey,
+               ByteSpan classical_sig, ByteSpan pq_sig) const noexcept;
+
+    // Whether key is cached; counts a hit or a miss
+    bool contains(const Hash32& key);
+
+    // Record that key verified, evicting the shard's oldest entry if it is full
+    void insert(const Hash32& key);
+
+    // Drop every entry (counters are kept)
+    void clear();
+
+    // Cached signatures
+    size_t size() const;
+
+    size_t capacity() const { return shard_capacity_ * (shard_mask_ + 1); }
+
+    VerifyCacheStats stats() const;
+
+    /**
+     * Write every cached key and the salt to a snapshot file (see
+     * VerifyCacheSnapshot). The file is written next to path and renamed
+     * over it, so a crash never leaves a torn snapshot behind.
+     *
+     * @param path Snapshot file
+     * @return Result indicating success, or FileWriteError
+     */
+    Result<void> save(const std::string& path) const;
+
+    /**
+     * Replace the cache contents with a snapshot's keys and adopt its salt, so
+     * that verifications from before a restart hit again. Must not run
+     * concurrently with other calls on this cache (load at startup).
+     *
+     * @param snapshot Snapshot to load
+     * @return Number of keys loaded; at most capacity(), the rest are dropped
+     */
+    size_t load(const VerifyCacheSnapshot& snapshot);
+
+    /**
+     * Open a snapshot file and load it (see load(const VerifyCacheSnapshot&)).
+     *
+     * @param path Snapshot file
+     * @return Result containing the number of keys loaded, FileReadError,
+     *         InvalidSnapshot or ChecksumMismatch
+     */
+    Result<size_t> load(const std::string& path);
+
+private:
+    struct Shard;
+
+    Shard& shard_for(const Hash32& key) const;
+
+    std::array<uint8_t, 32> salt_;
+    std::unique_ptr<Shard[]> shards_;
+    size_t shard_mask_;
+    size_t shard_capacity_;
+};
+
+/**
+ * Verified-signature cache snapshot, memory-mapped read-only.
+ *
+ * File format (integers big-endian):
+ *
+ *   header: "PQVC" | version u8 (= 1) | reserved u8[3] | slot count u64 |
+ *           key count u64 | crc32c u32 of the table | reserved u32 | salt[32]
+ *   table:  slot count x key[32], an open-addressed hash table with linear
+ *           probing; a key's home slot is its first 8 bytes modulo the slot
+ *           count, and all-zero slots are empty
+ *
+ * The slot count is a power of two at least twice the key count, so lookups
+ * in place touch one or two slots. Keys are only meaningful with the salt
+ * they were computed with, which is why the salt travels with them.
+ */
+class VerifyCacheSnapshot {
+public:
+    static constexpr size_t HEADER_SIZE = 64;
+    static constexpr uint8_t VERSION = 1;
+
+    // Empty snapshot (no keys)
+    VerifyCacheSnapshot() noexcept;
+    ~VerifyCacheSnapshot();
+
+    VerifyCacheSnapshot(VerifyCacheSnapshot&& other) noexcept;
+    VerifyCacheSnapshot& operator=(VerifyCacheSnapshot&& other) noexcept;
+
+    /**
+     * Map and check a snapshot file; the table checksum is verified, which
+     * reads the whole file once.
+     *
+     * @param path Snapshot file (VerifyCache::save())
+     * @return Result containing the snapshot, FileReadError, InvalidSnapshot
+     *         or ChecksumMismatch
+     */
+    static Result<VerifyCacheSnapshot> open(const std::string& path);
+
+    // Whether key (computed with salt()) is in the snapshot
+    bool contains(const Hash32& key) const noexcept;
+
+    const std::array<uint8_t, 32>& salt() const { return salt_; }
+
+    // Number of keys
+    uint64_t size() const { return count_; }
+
+private:
+    friend class VerifyCache;
+
+    std::unique_ptr<util::MappedFile> file_;
+    const uint8_t* table_;
+    uint64_t slots_;
+    uint64_t count_;
+    std::array<uint8_t, 32> salt_;
+};
+
+} // namespace pqc_ledger::tx
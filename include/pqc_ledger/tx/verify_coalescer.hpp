@@ -0,0 +1,107 @@
+#pragma once
+
+#include "../types.hpp"
+#include "../error.hpp"
+#include "../span.hpp"
+#include "verify_cache.hpp"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <unordered_map>
+
+namespace pqc_ledger::tx {
+
+/**
+ * Counters of a VerifyCoalescer.
+ */
+struct VerifyCoalescerStats {
+    uint64_t verifications = 0;  // Requests that ran the verification themselves
+    uint64_t coalesced = 0;      // Requests that waited for an identical one in flight
+};
+
+/**
+ * Single-flight layer for signature verification.
+ *
+ * During gossip storms the same transaction arrives from many peers at once.
+ * Requests are keyed by (txid, chain ID): the first one runs the verification
+ * and every identical request that arrives while it is in flight waits for it
+ * and receives the same result (or exception). Once it completes the key is
+ * released; with a VerifyCache, later duplicates then hit the cache instead.
+ *
+ * All member functions are thread-safe.
+ */
+class VerifyCoalescer {
+public:
+    /**
+     * @param cache Verified-signature cache used by the verifications this
+     *        coalescer runs, or null; must outlive the coalescer
+     */
+    explicit VerifyCoalescer(VerifyCache* cache = nullptr);
+
+    VerifyCoalescer(const VerifyCoalescer&) = delete;
+    VerifyCoalescer& operator=(const VerifyCoalescer&) = delete;
+
+    /**
+     * Verify an encoded transaction (as verify_encoded()), sharing the work
+     * with identical requests in flight. The txid is computed from wire.
+     *
+     * @param wire Encoded transaction
+     * @param chain_id Expected chain ID (for domain separation)
+     * @return Result<bool> - true if valid, false if invalid, or error
+     */
+    Result<bool> verify_encoded(ByteSpan wire, uint32_t chain_id);
+
+    /**
+     * Verify a transaction (as verify_transaction()), sharing the work with
+     * identical requests in flight. The txid is computed from its encoding.
+     *
+     * @param tx Transaction to verify
+     * @param chain_id Expected chain ID (for domain separation)
+     * @return Result<bool> - true if valid, false if invalid, or error
+     */
+    Result<bool> verify_transaction(const Transaction& tx, uint32_t chain_id);
+
+    /**
+     * Run verify unless a request with the same key is in flight, in which
+     * case wait for that one and return its result. Exceptions thrown by
+     * verify reach every waiting request.
+     *
+     * @param txid Transaction id (codec::compute_txid())
+     * @param chain_id Chain the result applies to
+     * @param verify Verification to run; must give the same answer as any other
+     *        request with this key
+     * @return The verification's result
+     */
+    Result<bool> run(const Hash32& txid, uint32_t chain_id,
+                     const std::function<Result<bool>()>& verify);
+
+    // Distinct verifications currently running
+    size_t in_flight() const;
+
+    VerifyCoalescerStats stats() const;
+
+private:
+    struct Key {
+        Hash32 txid;
+        uint32_t chain_id;
+
+        bool operator==(const Key& other) const {
+            return txid == other.txid && chain_id == other.chain_id;
+        }
+    };
+
+    struct KeyHasher {
+        size_t operator()(const Key& key) const noexcept;
+    };
+
+    VerifyCache* cache_;
+    mutable std::mutex mutex_;
+    std::unordered_map<Key, std::shared_future<Result<bool>>, KeyHasher> flights_;
+    std::atomic<uint64_t> verifications_;
+    std::atomic<uint64_t> coalesced_;
+};
+
+} // namespace pqc_ledger::tx
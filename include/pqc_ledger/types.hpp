@@ -4,17 +4,21 @@
 #include <cstdint>
 #include <vector>
 #include "error.hpp"
+#include "span.hpp"
 
 namespace pqc_ledger {
 
+// SHA-256 digest (signing messages, txids); fixed size, lives on the stack
+using Hash32 = std::array<uint8_t, 32>;
+
 // Address is 32 bytes (first 32 bytes of SHA256(pubkey))
 using Address = std::array<uint8_t, 32>;
 
 // Public key size depends on the PQ algorithm
-// Dilithium2: 1312 bytes, Dilithium3: 1952 bytes, Dilithium5: 2592 bytes
-// We'll use Dilithium3 as default (1952 bytes)
-constexpr size_t PQ_PUBKEY_SIZE = 1952;  // Dilithium3
-constexpr size_t PQ_SIG_SIZE = 3293;     // Dilithium3 signature size
+// ML-DSA-44: 1312 bytes, ML-DSA-65: 1952 bytes, ML-DSA-87: 2592 bytes
+// We'll use ML-DSA-65 (Dilithium3) as default; see crypto/params.hpp for all sizes
+constexpr size_t PQ_PUBKEY_SIZE = 1952;  // ML-DSA-65
+constexpr size_t PQ_SIG_SIZE = 3309;     // ML-DSA-65 signature size
 
 // Ed25519 sizes (for hybrid mode)
 constexpr size_t ED25519_PUBKEY_SIZE = 32;
@@ -58,5 +62,44 @@ struct Transaction {
     bool is_valid_structure() const;
 };
 
+// Non-owning view of an encoded transaction.
+// Variable-length fields point into the buffer the view was decoded from,
+// so that buffer must outlive the view.
+struct TransactionView {
+    uint8_t version = 0;
+    uint32_t chain_id = 0;
+    uint64_t nonce = 0;
+    ByteSpan from_pubkey;
+    Address to{};
+    uint64_t amount = 0;
+    uint64_t fee = 0;
+    AuthMode auth_mode = AuthMode::PqOnly;
+    
+    ByteSpan pq_sig;           // PQ signature (both auth modes)
+    ByteSpan classical_sig;    // Ed25519 signature (hybrid only, empty otherwise)
+    
+    ByteSpan signed_bytes;     // Unsigned fields as encoded (version through fee)
+    
+    // Copy into an owning Transaction
+    Transaction to_transaction() const {
+        Transaction tx;
+        tx.version = version;
+        tx.chain_id = chain_id;
+        tx.nonce = nonce;
+        tx.from_pubkey.assign(from_pubkey.begin(), from_pubkey.end());
+        tx.to = to;
+        tx.amount = amount;
+        tx.fee = fee;
+        tx.auth_mode = auth_mode;
+        if (auth_mode == AuthMode::Hybrid) {
+            tx.auth = HybridSignature{Signature(classical_sig.begin(), classical_sig.end()),
+                                      Signature(pq_sig.begin(), pq_sig.end())};
+        } else {
+            tx.auth = PqSignature{Signature(pq_sig.begin(), pq_sig.end())};
+        }
+        return tx;
+    }
+};
+
 } // namespace pqc_ledger
 
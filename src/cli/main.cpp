@@ -3,8 +3,7 @@
 #include <string>
 #include <vector>
 #include <fstream>
-#include <sstream>
-#include <iomanip>
+#include <algorithm>
 
 // Simple CLI argument parser (can be replaced with CLI11 or similar)
 class ArgParser {
@@ -32,50 +31,15 @@ private:
 };
 
 std::string bytes_to_hex(const std::vector<uint8_t>& bytes) {
-    std::ostringstream oss;
-    oss << std::hex << std::setfill('0');
-    for (uint8_t byte : bytes) {
-        oss << std::setw(2) << static_cast<int>(byte);
-    }
-    return oss.str();
+    return pqc_ledger::codec::hex_encode(bytes);
 }
 
 std::vector<uint8_t> hex_to_bytes(const std::string& hex) {
-    std::vector<uint8_t> bytes;
-    std::string clean_hex;
-    
-    // Remove whitespace
-    for (char c : hex) {
-        if (!std::isspace(static_cast<unsigned char>(c))) {
-            clean_hex += c;
-        }
-    }
-    
-    // Hex string must have even length
-    if (clean_hex.length() % 2 != 0) {
-        throw std::runtime_error("Hex string must have even length");
-    }
-    
-    // Validate and convert hex characters
-    for (size_t i = 0; i < clean_hex.length(); i += 2) {
-        std::string byte_str = clean_hex.substr(i, 2);
-        
-        // Validate hex characters
-        for (char c : byte_str) {
-            if (!((c >= '0' && c <= '9') || (c >= 'a' && c <= 'f') || (c >= 'A' && c <= 'F'))) {
-                throw std::runtime_error("Invalid hex character: " + std::string(1, c));
-            }
-        }
-        
-        // Convert with error handling
-        try {
-            bytes.push_back(static_cast<uint8_t>(std::stoul(byte_str, nullptr, 16)));
-        } catch (const std::exception& e) {
-            throw std::runtime_error("Invalid hex byte: " + byte_str);
-        }
+    auto bytes = pqc_ledger::codec::hex_decode(hex);
+    if (bytes.is_err()) {
+        throw std::runtime_error(bytes.error().message);
     }
-    
-    return bytes;
+    return bytes.value();
 }
 
 void print_usage() {
@@ -261,7 +225,8 @@ int cmd_sign_tx(const ArgParser& parser) {
             return 1;
         }
         
-        // Sign transaction
+        // Sign and encode in one pass over the unsigned fields
+        pqc_ledger::Result<std::vector<uint8_t>> encoded_result;
         if (!ed25519_key_path.empty()) {
             // Hybrid mode
             auto ed25519_privkey_result = pqc_ledger::crypto::load_ed25519_private_key(ed25519_key_path);
@@ -270,25 +235,14 @@ int cmd_sign_tx(const ArgParser& parser) {
                 return 1;
             }
             
-            auto sign_result = pqc_ledger::tx::sign_transaction_hybrid(
+            encoded_result = pqc_ledger::tx::sign_and_encode_transaction_hybrid(
                 tx, pq_privkey_result.value(), ed25519_privkey_result.value());
-            if (sign_result.is_err()) {
-                std::cerr << "Error signing transaction: " << sign_result.error().message << "\n";
-                return 1;
-            }
         } else {
             // PQ-only mode
-            auto sign_result = pqc_ledger::tx::sign_transaction(tx, pq_privkey_result.value());
-            if (sign_result.is_err()) {
-                std::cerr << "Error signing transaction: " << sign_result.error().message << "\n";
-                return 1;
-            }
+            encoded_result = pqc_ledger::tx::sign_and_encode_transaction(tx, pq_privkey_result.value());
         }
-        
-        // Encode signed transaction
-        auto encoded_result = pqc_ledger::codec::encode(tx);
         if (encoded_result.is_err()) {
-            std::cerr << "Error encoding signed transaction: " << encoded_result.error().message << "\n";
+            std::cerr << "Error signing transaction: " << encoded_result.error().message << "\n";
             return 1;
         }
         
@@ -0,0 +1,331 @@
+#include "pqc_ledger/codec/archive.hpp"
+#include "pqc_ledger/codec/encode.hpp"
+#include "pqc_ledger/codec/decode.hpp"
+#include "pqc_ledger/crypto/hash.hpp"
+#include "codec/byte_order.hpp"
+#include "util/mapped_file.hpp"
+#include <algorithm>
+#include <cstring>
+#include <string>
+
+namespace pqc_ledger::codec {
+
+namespace {
+    constexpr uint8_t kMagic[4] = {'P', 'Q', 'B', 'A'};
+    constexpr uint8_t kFooterMagic[4] = {'P', 'Q', 'B', 'E'};
+    constexpr size_t kOffsetSize = 8;
+
+    Error corrupt(const std::string& what) {
+        return Error(ErrorCode::InvalidArchive, "Invalid archive: " + what);
+    }
+}
+
+Hash32 compute_txid(ByteSpan encoded) noexcept {
+    crypto::Sha256 hasher;
+    hasher.update(encoded);
+    return hasher.final();
+}
+
+Result<Hash32> compute_txid(const Transaction& tx) {
+    crypto::Sha256 hasher;
+    auto hashed = hash_encoded(tx, hasher);
+    if (hashed.is_err()) {
+        return Result<Hash32>::Err(hashed.error());
+    }
+    return Result<Hash32>::Ok(hasher.final());
+}
+
+ArchiveWriter::ArchiveWriter(ByteSink sink, size_t buffer_size)
+    : sink_(std::move(sink)), buffer_size_(buffer_size), written_(0), finished_(false) {
+    buffer_.reserve(std::max(buffer_size_, ARCHIVE_HEADER_SIZE));
+    buffer_.insert(buffer_.end(), std::begin(kMagic), std::end(kMagic));
+    buffer_.push_back(ARCHIVE_VERSION);
+    buffer_.insert(buffer_.end(), 3, 0);
+}
+
+Result<void> ArchiveWriter::flush() {
+    if (buffer_.empty()) {
+        return Result<void>::Ok();
+    }
+    auto sent = sink_(buffer_);
+    if (sent.is_err()) {
+        return sent;
+    }
+    written_ += buffer_.size();
+    buffer_.clear();
+    return Result<void>::Ok();
+}
+
+Result<void> ArchiveWriter::put(ByteSpan data) {
+    if (!buffer_.empty() && buffer_.size() + data.size() > buffer_size_) {
+        auto flushed = flush();
+        if (flushed.is_err()) {
+            return flushed;
+        }
+    }
+    buffer_.insert(buffer_.end(), data.begin(), data.end());
+    return Result<void>::Ok();
+}
+
+Result<void> ArchiveWriter::append_checked(ByteSpan encoded) {
+    const uint64_t offset = written_ + buffer_.size();
+    auto stored = put(encoded);
+    if (stored.is_err()) {
+        return stored;
+    }
+    txids_.emplace_back(compute_txid(encoded), offsets_.size());
+    offsets_.push_back(offset);
+    return Result<void>::Ok();
+}
+
+Result<void> ArchiveWriter::append(const Transaction& tx) {
+    if (finished_) {
+        return Result<void>::Err(corrupt("append after finish()"));
+    }
+    const size_t size = encoded_size(tx);
+    if (!buffer_.empty() && buffer_.size() + size > buffer_size_) {
+        auto flushed = flush();
+        if (flushed.is_err()) {
+            return flushed;
+        }
+    }
+
+    // Encode straight into the buffer; the txid is hashed from there too
+    const size_t start = buffer_.size();
+    buffer_.resize(start + size);
+    auto written = encode_into(tx, MutableByteSpan(buffer_.data() + start, size));
+    if (written.is_err()) {
+        buffer_.resize(start);
+        return Result<void>::Err(written.error());
+    }
+    txids_.emplace_back(compute_txid(ByteSpan(buffer_.data() + start, size)), offsets_.size());
+    offsets_.push_back(written_ + start);
+    return Result<void>::Ok();
+}
+
+Result<void> ArchiveWriter::append_encoded(ByteSpan encoded) {
+    if (finished_) {
+        return Result<void>::Err(corrupt("append after finish()"));
+    }
+    auto decoded = decode_view(encoded.data(), encoded.size());
+    if (decoded.is_err()) {
+        return Result<void>::Err(decoded.error());
+    }
+    return append_checked(encoded);
+}
+
+Result<void> ArchiveWriter::finish() {
+    if (finished_) {
+        return Result<void>::Err(corrupt("finish() called twice"));
+    }
+    finished_ = true;
+
+    const uint64_t index_offset = written_ + buffer_.size();
+    uint32_t crc = 0;
+    uint8_t entry[ARCHIVE_TXID_ENTRY_SIZE];
+
+    auto put_checksummed = [&](ByteSpan data) {
+        crc = crc32c(data, crc);
+        return put(data);
+    };
+
+    offsets_.push_back(index_offset);
+    for (uint64_t offset : offsets_) {
+        detail::store_u64_be(entry, offset);
+        auto stored = put_checksummed(ByteSpan(entry, kOffsetSize));
+        if (stored.is_err()) {
+            return stored;
+        }
+    }
+    offsets_.pop_back();
+
+    const uint64_t txid_offset = written_ + buffer_.size();
+    std::sort(txids_.begin(), txids_.end());
+    for (const auto& [txid, position] : txids_) {
+        std::memcpy(entry, txid.data(), txid.size());
+        detail::store_u64_be(entry + txid.size(), position);
+        auto stored = put_checksummed(ByteSpan(entry, ARCHIVE_TXID_ENTRY_SIZE));
+        if (stored.is_err()) {
+            return stored;
+        }
+    }
+
+    uint8_t footer[ARCHIVE_FOOTER_SIZE];
+    detail::store_u64_be(footer, offsets_.size());
+    detail::store_u64_be(footer + 8, index_offset);
+    detail::store_u64_be(footer + 16, txid_offset);
+    detail::store_u32_be(footer + 24, crc);
+    std::memcpy(footer + 28, kFooterMagic, sizeof(kFooterMagic));
+    auto stored = put(ByteSpan(footer, sizeof(footer)));
+    if (stored.is_err()) {
+        return stored;
+    }
+    return flush();
+}
+
+ArchiveReader::ArchiveReader() noexcept
+    : data_(nullptr), size_(0), count_(0), index_offset_(0), txid_offset_(0) {}
+
+ArchiveReader::~ArchiveReader() = default;
+ArchiveReader::ArchiveReader(ArchiveReader&& other) noexcept = default;
+ArchiveReader& ArchiveReader::operator=(ArchiveReader&& other) noexcept = default;
+
+Result<ArchiveReader> ArchiveReader::open(const std::string& path) {
+    auto mapped = util::MappedFile::open(path);
+    if (mapped.is_err()) {
+        return Result<ArchiveReader>::Err(mapped.error());
+    }
+    ArchiveReader reader;
+    reader.file_ = std::make_unique<util::MappedFile>(std::move(mapped.value()));
+    auto parsed = reader.parse(reader.file_->bytes());
+    if (parsed.is_err()) {
+        return Result<ArchiveReader>::Err(parsed.error());
+    }
+    return Result<ArchiveReader>::Ok(std::move(reader));
+}
+
+Result<ArchiveReader> ArchiveReader::over(ByteSpan data) {
+    ArchiveReader reader;
+    auto parsed = reader.parse(data);
+    if (parsed.is_err()) {
+        return Result<ArchiveReader>::Err(parsed.error());
+    }
+    return Result<ArchiveReader>::Ok(std::move(reader));
+}
+
+Result<void> ArchiveReader::parse(ByteSpan data) {
+    const uint8_t* p = data.data();
+    const uint64_t size = data.size();
+    if (size < ARCHIVE_HEADER_SIZE + kOffsetSize + ARCHIVE_FOOTER_SIZE) {
+        return Result<void>::Err(corrupt("shorter than header, index and footer"));
+    }
+    if (std::memcmp(p, kMagic, sizeof(kMagic)) != 0) {
+        return Result<void>::Err(corrupt("bad magic"));
+    }
+    if (p[4] != ARCHIVE_VERSION) {
+        return Result<void>::Err(corrupt("unsupported version " + std::to_string(p[4])));
+    }
+    if (p[5] != 0 || p[6] != 0 || p[7] != 0) {
+        return Result<void>::Err(corrupt("reserved header bytes are set"));
+    }
+
+    const uint8_t* footer = p + size - ARCHIVE_FOOTER_SIZE;
+    if (std::memcmp(footer + 28, kFooterMagic, sizeof(kFooterMagic)) != 0) {
+        return Result<void>::Err(corrupt("bad footer magic (incomplete write?)"));
+    }
+    const uint64_t count = detail::load_u64_be(footer);
+    const uint64_t index_offset = detail::load_u64_be(footer + 8);
+    const uint64_t txid_offset = detail::load_u64_be(footer + 16);
+
+    // Bound count first so the layout arithmetic below cannot overflow
+    const uint64_t tables_end = size - ARCHIVE_FOOTER_SIZE;
+    if (count > tables_end / (kOffsetSize + ARCHIVE_TXID_ENTRY_SIZE) ||
+        index_offset < ARCHIVE_HEADER_SIZE || index_offset > tables_end ||
+        txid_offset != index_offset + (count + 1) * kOffsetSize ||
+        txid_offset + count * ARCHIVE_TXID_ENTRY_SIZE != tables_end) {
+        return Result<void>::Err(corrupt("footer does not match the file layout"));
+    }
+
+    data_ = p;
+    size_ = size;
+    count_ = count;
+    index_offset_ = index_offset;
+    txid_offset_ = txid_offset;
+    if (offset_at(0) != ARCHIVE_HEADER_SIZE || offset_at(count) != index_offset) {
+        return Result<void>::Err(corrupt("offset index does not span the tx region"));
+    }
+    return Result<void>::Ok();
+}
+
+uint64_t ArchiveReader::offset_at(uint64_t index) const {
+    return detail::load_u64_be(data_ + index_offset_ + index * kOffsetSize);
+}
+
+Result<ByteSpan> ArchiveReader::encoded(uint64_t index) const {
+    if (index >= count_) {
+        return Result<ByteSpan>::Err(Error(ErrorCode::InvalidArchive,
+            "Transaction index " + std::to_string(index) + " out of range (archive holds " +
+            std::to_string(count_) + ")"));
+    }
+    const uint64_t begin = offset_at(index);
+    const uint64_t end = offset_at(index + 1);
+    if (begin < ARCHIVE_HEADER_SIZE || begin >= end || end > index_offset_) {
+        return Result<ByteSpan>::Err(corrupt("bad offset index entry " + std::to_string(index)));
+    }
+    return Result<ByteSpan>::Ok(ByteSpan(data_ + begin, static_cast<size_t>(end - begin)));
+}
+
+Result<TransactionView> ArchiveReader::at(uint64_t index) const {
+    auto bytes = encoded(index);
+    if (bytes.is_err()) {
+        return Result<TransactionView>::Err(bytes.error());
+    }
+    return decode_view(bytes.value().data(), bytes.value().size());
+}
+
+Result<bool> ArchiveReader::find(const Hash32& txid, uint64_t& index) const {
+    const uint8_t* table = data_ + txid_offset_;
+    uint64_t low = 0;
+    uint64_t high = count_;
+    while (low < high) {
+        const uint64_t mid = low + (high - low) / 2;
+        if (std::memcmp(table + mid * ARCHIVE_TXID_ENTRY_SIZE, txid.data(), txid.size()) < 0) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    const uint8_t* entry = table + low * ARCHIVE_TXID_ENTRY_SIZE;
+    if (low == count_ || std::memcmp(entry, txid.data(), txid.size()) != 0) {
+        return Result<bool>::Ok(false);
+    }
+    const uint64_t position = detail::load_u64_be(entry + txid.size());
+    if (position >= count_) {
+        return Result<bool>::Err(corrupt("bad txid table entry " + std::to_string(low)));
+    }
+    index = position;
+    return Result<bool>::Ok(true);
+}
+
+Result<void> ArchiveReader::verify() const {
+    const uint8_t* footer = data_ + size_ - ARCHIVE_FOOTER_SIZE;
+    ByteSpan tables(data_ + index_offset_, static_cast<size_t>(size_ - ARCHIVE_FOOTER_SIZE -
+                                                              index_offset_));
+    if (crc32c(tables) != detail::load_u32_be(footer + 24)) {
+        return Result<void>::Err(Error(ErrorCode::ChecksumMismatch,
+            "Invalid archive: offset index and txid table checksum mismatch"));
+    }
+
+    // Every transaction once, in table order; positions must form a permutation
+    std::vector<bool> seen(static_cast<size_t>(count_), false);
+    const uint8_t* table = data_ + txid_offset_;
+    for (uint64_t i = 0; i < count_; ++i) {
+        const uint8_t* entry = table + i * ARCHIVE_TXID_ENTRY_SIZE;
+        if (i > 0 && std::memcmp(entry - ARCHIVE_TXID_ENTRY_SIZE, entry, 32) > 0) {
+            return Result<void>::Err(corrupt("txid table is not sorted at entry " +
+                                             std::to_string(i)));
+        }
+        const uint64_t position = detail::load_u64_be(entry + 32);
+        if (position >= count_ || seen[position]) {
+            return Result<void>::Err(corrupt("bad txid table entry " + std::to_string(i)));
+        }
+        seen[position] = true;
+
+        auto bytes = encoded(position);
+        if (bytes.is_err()) {
+            return Result<void>::Err(bytes.error());
+        }
+        auto view = decode_view(bytes.value().data(), bytes.value().size());
+        if (view.is_err()) {
+            return Result<void>::Err(view.error());
+        }
+        Hash32 txid = compute_txid(bytes.value());
+        if (std::memcmp(entry, txid.data(), txid.size()) != 0) {
+            return Result<void>::Err(corrupt("txid of transaction " + std::to_string(position) +
+                                             " does not match its table entry"));
+        }
+    }
+    return Result<void>::Ok();
+}
+
+} // namespace pqc_ledger::codec
@@ -0,0 +1,297 @@
+#include "pqc_ledger/codec/base64.hpp"
+#include "codec/base64_backend.hpp"
+#include <array>
+#include <string>
+
+namespace pqc_ledger::codec {
+
+namespace {
+    constexpr uint8_t kPad = 0x40;
+    constexpr uint8_t kSpace = 0xfe;
+    constexpr uint8_t kInvalid = 0xff;
+
+    constexpr char kAlphabet[] =
+        "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+    // Character -> sextet, kPad for '=', kSpace for ASCII whitespace (as
+    // std::isspace in the C locale), kInvalid for everything else. Every
+    // non-sextet entry is above 63, so one OR tells whether a group is plain data.
+    constexpr std::array<uint8_t, 256> make_decode_table() {
+        std::array<uint8_t, 256> table{};
+        for (size_t c = 0; c < 256; ++c) {
+            table[c] = kInvalid;
+        }
+        for (uint8_t i = 0; i < 64; ++i) {
+            table[static_cast<uint8_t>(kAlphabet[i])] = i;
+        }
+        table['='] = kPad;
+        for (char c : {' ', '\t', '\n', '\v', '\f', '\r'}) {
+            table[static_cast<uint8_t>(c)] = kSpace;
+        }
+        return table;
+    }
+
+    constexpr std::array<uint8_t, 256> kDecodeTable = make_decode_table();
+
+    Base64Backend select_backend() {
+        if (detail::base64_avx2_supported()) {
+            return Base64Backend::Avx2;
+        }
+        if (detail::base64_ssse3_supported()) {
+            return Base64Backend::Ssse3;
+        }
+        return Base64Backend::Portable;
+    }
+
+    Base64Backend usable(Base64Backend backend) {
+        return base64_backend_available(backend) ? backend : Base64Backend::Portable;
+    }
+
+    void encode_portable(const uint8_t* in, size_t size, char* out) {
+        size_t i = 0;
+        for (; size - i >= 3; i += 3) {
+            uint32_t group = (uint32_t(in[i]) << 16) | (uint32_t(in[i + 1]) << 8) | in[i + 2];
+            out[0] = kAlphabet[(group >> 18) & 0x3f];
+            out[1] = kAlphabet[(group >> 12) & 0x3f];
+            out[2] = kAlphabet[(group >> 6) & 0x3f];
+            out[3] = kAlphabet[group & 0x3f];
+            out += 4;
+        }
+        if (i == size) {
+            return;
+        }
+        uint32_t group = uint32_t(in[i]) << 16;
+        if (size - i == 2) {
+            group |= uint32_t(in[i + 1]) << 8;
+        }
+        out[0] = kAlphabet[(group >> 18) & 0x3f];
+        out[1] = kAlphabet[(group >> 12) & 0x3f];
+        out[2] = size - i == 2 ? kAlphabet[(group >> 6) & 0x3f] : '=';
+        out[3] = '=';
+    }
+
+    // Portable block kernel: whole 4-character groups until anything else shows up
+    size_t decode_groups_portable(const char* in, size_t size, uint8_t* out, size_t out_size) {
+        size_t done = 0;
+        size_t written = 0;
+        while (size - done >= 4 && out_size - written >= 3) {
+            uint32_t a = kDecodeTable[static_cast<uint8_t>(in[done])];
+            uint32_t b = kDecodeTable[static_cast<uint8_t>(in[done + 1])];
+            uint32_t c = kDecodeTable[static_cast<uint8_t>(in[done + 2])];
+            uint32_t d = kDecodeTable[static_cast<uint8_t>(in[done + 3])];
+            if ((a | b | c | d) > 63) {
+                break;
+            }
+            uint32_t group = (a << 18) | (b << 12) | (c << 6) | d;
+            out[written] = static_cast<uint8_t>(group >> 16);
+            out[written + 1] = static_cast<uint8_t>(group >> 8);
+            out[written + 2] = static_cast<uint8_t>(group);
+            written += 3;
+            done += 4;
+        }
+        return done;
+    }
+
+    size_t decode_blocks(Base64Backend backend, const char* in, size_t size, uint8_t* out,
+                         size_t out_size) {
+        switch (backend) {
+            case Base64Backend::Avx2:
+                return detail::base64_decode_avx2(in, size, out, out_size);
+            case Base64Backend::Ssse3:
+                return detail::base64_decode_ssse3(in, size, out, out_size);
+            case Base64Backend::Portable:
+                break;
+        }
+        return decode_groups_portable(in, size, out, out_size);
+    }
+
+    Error malformed(const char* what) {
+        return Error(ErrorCode::InvalidBase64Encoding,
+                     std::string("Invalid base64 string: ") + what);
+    }
+}
+
+Base64Backend base64_backend() {
+    static const Base64Backend backend = select_backend();
+    return backend;
+}
+
+bool base64_backend_available(Base64Backend backend) {
+    switch (backend) {
+        case Base64Backend::Portable:
+            return true;
+        case Base64Backend::Ssse3:
+            return detail::base64_ssse3_supported();
+        case Base64Backend::Avx2:
+            return detail::base64_avx2_supported();
+    }
+    return false;
+}
+
+const char* base64_backend_name(Base64Backend backend) {
+    switch (backend) {
+        case Base64Backend::Portable:
+            return "portable";
+        case Base64Backend::Ssse3:
+            return "ssse3";
+        case Base64Backend::Avx2:
+            return "avx2";
+    }
+    return "unknown";
+}
+
+void base64_encode_into(ByteSpan bytes, char* out) noexcept {
+    base64_encode_into(bytes, out, base64_backend());
+}
+
+void base64_encode_into(ByteSpan bytes, char* out, Base64Backend backend) noexcept {
+    const uint8_t* in = bytes.data();
+    const size_t size = bytes.size();
+
+    // Kernels consume whole 3-byte groups, so the text stays aligned for the tail
+    size_t done = 0;
+    switch (usable(backend)) {
+        case Base64Backend::Avx2:
+            done = detail::base64_encode_avx2(in, size, out);
+            break;
+        case Base64Backend::Ssse3:
+            done = detail::base64_encode_ssse3(in, size, out);
+            break;
+        case Base64Backend::Portable:
+            break;
+    }
+    encode_portable(in + done, size - done, out + done / 3 * 4);
+}
+
+std::string base64_encode(ByteSpan bytes) {
+    std::string result(base64_encoded_size(bytes.size()), '\0');
+    base64_encode_into(bytes, result.data());
+    return result;
+}
+
+Base64Decoder::Base64Decoder() noexcept : Base64Decoder(base64_backend()) {}
+
+Base64Decoder::Base64Decoder(Base64Backend backend) noexcept : backend_(usable(backend)) {
+    reset();
+}
+
+void Base64Decoder::reset() noexcept {
+    group_ = 0;
+    group_len_ = 0;
+    padding_ = 0;
+    ended_ = false;
+    position_ = 0;
+}
+
+Result<size_t> Base64Decoder::update(std::string_view chunk, MutableByteSpan out) {
+    const char* in = chunk.data();
+    const size_t size = chunk.size();
+    uint8_t* dst = out.data();
+    const size_t capacity = out.size();
+
+    size_t pos = 0;
+    size_t written = 0;
+    while (pos < size) {
+        if (group_len_ == 0 && !ended_) {
+            size_t consumed = decode_blocks(backend_, in + pos, size - pos, dst + written,
+                                            capacity - written);
+            pos += consumed;
+            written += consumed / 4 * 3;
+        }
+
+        // Whatever stopped the kernel (whitespace, padding, an invalid character,
+        // a full output or a short tail) is handled here, one character at a time
+        // until the next group boundary
+        const size_t scalar_begin = pos;
+        for (; pos < size; ++pos) {
+            if (pos > scalar_begin && group_len_ == 0 && !ended_) {
+                break;
+            }
+            uint8_t value = kDecodeTable[static_cast<uint8_t>(in[pos])];
+            if (value == kSpace) {
+                continue;
+            }
+            if (value == kInvalid) {
+                return Result<size_t>::Err(Error(ErrorCode::InvalidBase64Encoding,
+                    "Invalid base64 character at position " + std::to_string(position_ + pos)));
+            }
+            if (ended_) {
+                return Result<size_t>::Err(malformed("data after padding"));
+            }
+            if (value == kPad) {
+                if (group_len_ < 2) {
+                    return Result<size_t>::Err(malformed("misplaced padding"));
+                }
+                ++padding_;
+            } else {
+                if (padding_ > 0) {
+                    return Result<size_t>::Err(malformed("misplaced padding"));
+                }
+                group_ = (group_ << 6) | value;
+            }
+            if (++group_len_ < 4) {
+                continue;
+            }
+
+            // Group complete: padding_ sextets are missing from the low end
+            const size_t count = 3 - padding_;
+            if (capacity - written < count) {
+                return Result<size_t>::Err(Error(ErrorCode::MismatchedLength,
+                    "Base64 output buffer too small: " + std::to_string(capacity) + " bytes"));
+            }
+            const uint32_t bits = group_ << (6 * padding_);
+            dst[written] = static_cast<uint8_t>(bits >> 16);
+            if (count > 1) {
+                dst[written + 1] = static_cast<uint8_t>(bits >> 8);
+            }
+            if (count > 2) {
+                dst[written + 2] = static_cast<uint8_t>(bits);
+            }
+            written += count;
+            ended_ = padding_ > 0;
+            group_ = 0;
+            group_len_ = 0;
+            padding_ = 0;
+        }
+    }
+
+    position_ += size;
+    return Result<size_t>::Ok(written);
+}
+
+Result<void> Base64Decoder::finish() const {
+    if (group_len_ != 0) {
+        return Result<void>::Err(malformed("incomplete group"));
+    }
+    return Result<void>::Ok();
+}
+
+Result<size_t> base64_decode_into(std::string_view base64, MutableByteSpan out) {
+    return base64_decode_into(base64, out, base64_backend());
+}
+
+Result<size_t> base64_decode_into(std::string_view base64, MutableByteSpan out,
+                                  Base64Backend backend) {
+    Base64Decoder decoder(backend);
+    auto written = decoder.update(base64, out);
+    if (written.is_err()) {
+        return written;
+    }
+    auto finished = decoder.finish();
+    if (finished.is_err()) {
+        return Result<size_t>::Err(finished.error());
+    }
+    return written;
+}
+
+Result<std::vector<uint8_t>> base64_decode(std::string_view base64) {
+    std::vector<uint8_t> bytes(base64.size() / 4 * 3);
+    auto written = base64_decode_into(base64, bytes);
+    if (written.is_err()) {
+        return Result<std::vector<uint8_t>>::Err(written.error());
+    }
+    bytes.resize(written.value());
+    return Result<std::vector<uint8_t>>::Ok(std::move(bytes));
+}
+
+} // namespace pqc_ledger::codec
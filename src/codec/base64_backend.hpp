@@ -0,0 +1,26 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace pqc_ledger::codec::detail {
+
+// Block kernels. Each converts as many whole blocks from the front of the input
+// as it can and returns the number of input units (bytes for encode, characters
+// for decode) it consumed; the caller finishes the rest with the scalar code.
+// Vector loads and stores are wider than a block, so a kernel also stops while
+// the input or the output has less than a full register left. Decoding stops
+// before the first block that holds anything other than the base64 alphabet
+// (whitespace, padding, invalid characters).
+
+// SSSE3: 12 bytes / 16 characters per block; only call when base64_ssse3_supported()
+size_t base64_encode_ssse3(const uint8_t* in, size_t size, char* out);
+size_t base64_decode_ssse3(const char* in, size_t size, uint8_t* out, size_t out_size);
+bool base64_ssse3_supported();
+
+// AVX2: 24 bytes / 32 characters per block; only call when base64_avx2_supported()
+size_t base64_encode_avx2(const uint8_t* in, size_t size, char* out);
+size_t base64_decode_avx2(const char* in, size_t size, uint8_t* out, size_t out_size);
+bool base64_avx2_supported();
+
+} // namespace pqc_ledger::codec::detail
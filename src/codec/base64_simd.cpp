@@ -0,0 +1,210 @@
+#include "codec/base64_backend.hpp"
+#include "util/cpu_features.hpp"
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#define PQC_LEDGER_BASE64_SIMD 1
+#include <immintrin.h>
+#endif
+
+// Enabled per function like the hex and SHA-256 kernels; callers check cpuid first
+#if defined(PQC_LEDGER_BASE64_SIMD) && (defined(__GNUC__) || defined(__clang__))
+#define PQC_LEDGER_TARGET_SSSE3 __attribute__((target("ssse3")))
+#define PQC_LEDGER_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define PQC_LEDGER_TARGET_SSSE3
+#define PQC_LEDGER_TARGET_AVX2
+#endif
+
+// The kernels follow W. Mula and D. Lemire, "Faster Base64 Encoding and Decoding
+// Using AVX2 Instructions" (2018): the encoder splits each 3-byte group into four
+// sextets with multiplies and maps them to ASCII with one pshufb of per-range
+// offsets; the decoder classifies every character by its two nibbles (pshufb
+// lookups whose AND is zero exactly for the alphabet), subtracts per-range
+// offsets and packs four sextets into three bytes with pmaddubsw/pmaddwd.
+
+namespace pqc_ledger::codec::detail {
+
+#ifdef PQC_LEDGER_BASE64_SIMD
+
+// Nibble classes: a character is in the alphabet iff lo_class & hi_class == 0
+#define PQC_LEDGER_BASE64_LO_CLASS                                                  \
+    0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x1a, 0x1b, 0x1b, 0x1b, 0x1a
+#define PQC_LEDGER_BASE64_HI_CLASS                                                  \
+    0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10
+// ASCII -> sextet offset by high nibble; index 1 is '/' (high nibble 2, minus one)
+#define PQC_LEDGER_BASE64_ROLL 0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0
+
+namespace {
+    // Per 32-bit lane: bytes [a b c] of one group -> sextets in output order
+    PQC_LEDGER_TARGET_SSSE3
+    inline __m128i sextets_ssse3(__m128i in) {
+        in = _mm_shuffle_epi8(in, _mm_setr_epi8(1, 0, 2, 1, 4, 3, 5, 4,
+                                                7, 6, 8, 7, 10, 9, 11, 10));
+        const __m128i t0 = _mm_and_si128(in, _mm_set1_epi32(0x0fc0fc00));
+        const __m128i t1 = _mm_mulhi_epu16(t0, _mm_set1_epi32(0x04000040));
+        const __m128i t2 = _mm_and_si128(in, _mm_set1_epi32(0x003f03f0));
+        const __m128i t3 = _mm_mullo_epi16(t2, _mm_set1_epi32(0x01000010));
+        return _mm_or_si128(t1, t3);
+    }
+
+    // Sextet -> ASCII: pick the range's offset (A-Z, a-z, 0-9, '+', '/') and add it
+    PQC_LEDGER_TARGET_SSSE3
+    inline __m128i ascii_ssse3(__m128i sextets) {
+        __m128i range = _mm_subs_epu8(sextets, _mm_set1_epi8(51));
+        const __m128i upper = _mm_cmpgt_epi8(_mm_set1_epi8(26), sextets);
+        range = _mm_or_si128(range, _mm_and_si128(upper, _mm_set1_epi8(13)));
+        const __m128i offsets = _mm_setr_epi8('a' - 26, '0' - 52, '0' - 52, '0' - 52,
+                                              '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+                                              '0' - 52, '0' - 52, '0' - 52, '+' - 62,
+                                              '/' - 63, 'A', 0, 0);
+        return _mm_add_epi8(_mm_shuffle_epi8(offsets, range), sextets);
+    }
+
+    PQC_LEDGER_TARGET_AVX2
+    inline __m256i sextets_avx2(__m256i in) {
+        in = _mm256_shuffle_epi8(in, _mm256_setr_epi8(1, 0, 2, 1, 4, 3, 5, 4,
+                                                      7, 6, 8, 7, 10, 9, 11, 10,
+                                                      1, 0, 2, 1, 4, 3, 5, 4,
+                                                      7, 6, 8, 7, 10, 9, 11, 10));
+        const __m256i t0 = _mm256_and_si256(in, _mm256_set1_epi32(0x0fc0fc00));
+        const __m256i t1 = _mm256_mulhi_epu16(t0, _mm256_set1_epi32(0x04000040));
+        const __m256i t2 = _mm256_and_si256(in, _mm256_set1_epi32(0x003f03f0));
+        const __m256i t3 = _mm256_mullo_epi16(t2, _mm256_set1_epi32(0x01000010));
+        return _mm256_or_si256(t1, t3);
+    }
+
+    PQC_LEDGER_TARGET_AVX2
+    inline __m256i ascii_avx2(__m256i sextets) {
+        __m256i range = _mm256_subs_epu8(sextets, _mm256_set1_epi8(51));
+        const __m256i upper = _mm256_cmpgt_epi8(_mm256_set1_epi8(26), sextets);
+        range = _mm256_or_si256(range, _mm256_and_si256(upper, _mm256_set1_epi8(13)));
+        const __m256i offsets = _mm256_setr_epi8('a' - 26, '0' - 52, '0' - 52, '0' - 52,
+                                                 '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+                                                 '0' - 52, '0' - 52, '0' - 52, '+' - 62,
+                                                 '/' - 63, 'A', 0, 0,
+                                                 'a' - 26, '0' - 52, '0' - 52, '0' - 52,
+                                                 '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+                                                 '0' - 52, '0' - 52, '0' - 52, '+' - 62,
+                                                 '/' - 63, 'A', 0, 0);
+        return _mm256_add_epi8(_mm256_shuffle_epi8(offsets, range), sextets);
+    }
+}
+
+PQC_LEDGER_TARGET_SSSE3
+size_t base64_encode_ssse3(const uint8_t* in, size_t size, char* out) {
+    size_t done = 0;
+    for (; size - done >= 16; done += 12) {
+        const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + done));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + done / 3 * 4),
+                         ascii_ssse3(sextets_ssse3(bytes)));
+    }
+    return done;
+}
+
+PQC_LEDGER_TARGET_SSSE3
+size_t base64_decode_ssse3(const char* in, size_t size, uint8_t* out, size_t out_size) {
+    const __m128i lo_class = _mm_setr_epi8(PQC_LEDGER_BASE64_LO_CLASS);
+    const __m128i hi_class = _mm_setr_epi8(PQC_LEDGER_BASE64_HI_CLASS);
+    const __m128i roll = _mm_setr_epi8(PQC_LEDGER_BASE64_ROLL);
+    const __m128i nibble_mask = _mm_set1_epi8(0x2f);
+
+    size_t done = 0;
+    while (size - done >= 16 && out_size - done / 4 * 3 >= 16) {
+        const __m128i chars = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + done));
+        const __m128i hi = _mm_and_si128(_mm_srli_epi32(chars, 4), nibble_mask);
+        const __m128i lo = _mm_and_si128(chars, nibble_mask);
+        const __m128i classes = _mm_and_si128(_mm_shuffle_epi8(lo_class, lo),
+                                              _mm_shuffle_epi8(hi_class, hi));
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(classes, _mm_setzero_si128())) != 0xffff) {
+            break;
+        }
+        const __m128i slash = _mm_cmpeq_epi8(chars, _mm_set1_epi8('/'));
+        const __m128i sextets =
+            _mm_add_epi8(chars, _mm_shuffle_epi8(roll, _mm_add_epi8(slash, hi)));
+
+        // Four sextets -> one 24-bit value per 32-bit lane, then drop the high bytes
+        const __m128i pairs = _mm_maddubs_epi16(sextets, _mm_set1_epi32(0x01400140));
+        const __m128i groups = _mm_madd_epi16(pairs, _mm_set1_epi32(0x00011000));
+        const __m128i bytes = _mm_shuffle_epi8(
+            groups, _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + done / 4 * 3), bytes);
+        done += 16;
+    }
+    return done;
+}
+
+bool base64_ssse3_supported() {
+    return util::cpu_features().ssse3;
+}
+
+PQC_LEDGER_TARGET_AVX2
+size_t base64_encode_avx2(const uint8_t* in, size_t size, char* out) {
+    size_t done = 0;
+    // Each 128-bit lane encodes 12 bytes; the second load reads 4 bytes past the block
+    for (; size - done >= 28; done += 24) {
+        const __m128i low = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + done));
+        const __m128i high = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + done + 12));
+        const __m256i bytes = _mm256_inserti128_si256(_mm256_castsi128_si256(low), high, 1);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + done / 3 * 4),
+                            ascii_avx2(sextets_avx2(bytes)));
+    }
+    return done;
+}
+
+PQC_LEDGER_TARGET_AVX2
+size_t base64_decode_avx2(const char* in, size_t size, uint8_t* out, size_t out_size) {
+    const __m256i lo_class = _mm256_setr_epi8(PQC_LEDGER_BASE64_LO_CLASS,
+                                              PQC_LEDGER_BASE64_LO_CLASS);
+    const __m256i hi_class = _mm256_setr_epi8(PQC_LEDGER_BASE64_HI_CLASS,
+                                              PQC_LEDGER_BASE64_HI_CLASS);
+    const __m256i roll = _mm256_setr_epi8(PQC_LEDGER_BASE64_ROLL, PQC_LEDGER_BASE64_ROLL);
+    const __m256i nibble_mask = _mm256_set1_epi8(0x2f);
+    const __m256i pack = _mm256_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1,
+                                          2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1);
+
+    size_t done = 0;
+    while (size - done >= 32 && out_size - done / 4 * 3 >= 32) {
+        const __m256i chars = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + done));
+        const __m256i hi = _mm256_and_si256(_mm256_srli_epi32(chars, 4), nibble_mask);
+        const __m256i lo = _mm256_and_si256(chars, nibble_mask);
+        if (!_mm256_testz_si256(_mm256_shuffle_epi8(lo_class, lo),
+                                _mm256_shuffle_epi8(hi_class, hi))) {
+            break;
+        }
+        const __m256i slash = _mm256_cmpeq_epi8(chars, _mm256_set1_epi8('/'));
+        const __m256i sextets =
+            _mm256_add_epi8(chars, _mm256_shuffle_epi8(roll, _mm256_add_epi8(slash, hi)));
+
+        const __m256i pairs = _mm256_maddubs_epi16(sextets, _mm256_set1_epi32(0x01400140));
+        const __m256i groups = _mm256_madd_epi16(pairs, _mm256_set1_epi32(0x00011000));
+        // 12 bytes at the bottom of each lane; close the gap between the lanes
+        const __m256i bytes = _mm256_permutevar8x32_epi32(
+            _mm256_shuffle_epi8(groups, pack), _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 3, 7));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + done / 4 * 3), bytes);
+        done += 32;
+    }
+    return done;
+}
+
+bool base64_avx2_supported() {
+    return util::cpu_features().avx2;
+}
+
+#undef PQC_LEDGER_BASE64_LO_CLASS
+#undef PQC_LEDGER_BASE64_HI_CLASS
+#undef PQC_LEDGER_BASE64_ROLL
+
+#else
+
+// Never called: the *_supported() checks are false on this target
+size_t base64_encode_ssse3(const uint8_t*, size_t, char*) { return 0; }
+size_t base64_decode_ssse3(const char*, size_t, uint8_t*, size_t) { return 0; }
+bool base64_ssse3_supported() { return false; }
+
+size_t base64_encode_avx2(const uint8_t*, size_t, char*) { return 0; }
+size_t base64_decode_avx2(const char*, size_t, uint8_t*, size_t) { return 0; }
+bool base64_avx2_supported() { return false; }
+
+#endif
+
+} // namespace pqc_ledger::codec::detail
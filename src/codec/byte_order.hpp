@@ -0,0 +1,33 @@
+#pragma once
+
+#include <cstdint>
+
+namespace pqc_ledger::codec::detail {
+
+// Big-endian loads and stores on unaligned wire bytes; callers have bounds-checked p
+
+inline uint16_t load_u16_be(const uint8_t* p) {
+    return static_cast<uint16_t>((static_cast<uint16_t>(p[0]) << 8) | p[1]);
+}
+
+inline uint32_t load_u32_be(const uint8_t* p) {
+    return (static_cast<uint32_t>(load_u16_be(p)) << 16) | load_u16_be(p + 2);
+}
+
+inline uint64_t load_u64_be(const uint8_t* p) {
+    return (static_cast<uint64_t>(load_u32_be(p)) << 32) | load_u32_be(p + 4);
+}
+
+inline void store_u32_be(uint8_t* p, uint32_t value) {
+    p[0] = static_cast<uint8_t>(value >> 24);
+    p[1] = static_cast<uint8_t>(value >> 16);
+    p[2] = static_cast<uint8_t>(value >> 8);
+    p[3] = static_cast<uint8_t>(value);
+}
+
+inline void store_u64_be(uint8_t* p, uint64_t value) {
+    store_u32_be(p, static_cast<uint32_t>(value >> 32));
+    store_u32_be(p + 4, static_cast<uint32_t>(value));
+}
+
+} // namespace pqc_ledger::codec::detail
@@ -0,0 +1,93 @@
+#include "pqc_ledger/codec/stream.hpp"
+#include "util/cpu_features.hpp"
+#include <array>
+#include <cstring>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define PQC_LEDGER_CRC32C_HW 1
+#include <immintrin.h>
+#endif
+
+// Enabled per function like the SHA-256 kernels; callers check cpuid first
+#if defined(PQC_LEDGER_CRC32C_HW) && (defined(__GNUC__) || defined(__clang__))
+#define PQC_LEDGER_TARGET_SSE42 __attribute__((target("sse4.2")))
+#else
+#define PQC_LEDGER_TARGET_SSE42
+#endif
+
+namespace pqc_ledger::codec {
+
+namespace {
+    constexpr uint32_t kPolynomial = 0x82f63b78;  // Castagnoli, bit-reflected
+
+    // Slicing-by-8: tables[k][b] is the CRC of byte b followed by k zero bytes
+    using Crc32cTables = std::array<std::array<uint32_t, 256>, 8>;
+
+    constexpr Crc32cTables make_tables() {
+        Crc32cTables tables{};
+        for (uint32_t b = 0; b < 256; ++b) {
+            uint32_t crc = b;
+            for (int bit = 0; bit < 8; ++bit) {
+                crc = (crc >> 1) ^ ((crc & 1) ? kPolynomial : 0);
+            }
+            tables[0][b] = crc;
+        }
+        for (size_t k = 1; k < 8; ++k) {
+            for (size_t b = 0; b < 256; ++b) {
+                uint32_t prev = tables[k - 1][b];
+                tables[k][b] = (prev >> 8) ^ tables[0][prev & 0xff];
+            }
+        }
+        return tables;
+    }
+
+    constexpr Crc32cTables kTables = make_tables();
+
+    uint32_t update_portable(uint32_t crc, const uint8_t* p, size_t size) {
+        while (size >= 8) {
+            uint32_t lo = crc ^ (uint32_t(p[0]) | (uint32_t(p[1]) << 8) |
+                                 (uint32_t(p[2]) << 16) | (uint32_t(p[3]) << 24));
+            crc = kTables[7][lo & 0xff] ^ kTables[6][(lo >> 8) & 0xff] ^
+                  kTables[5][(lo >> 16) & 0xff] ^ kTables[4][lo >> 24] ^
+                  kTables[3][p[4]] ^ kTables[2][p[5]] ^ kTables[1][p[6]] ^ kTables[0][p[7]];
+            p += 8;
+            size -= 8;
+        }
+        while (size-- > 0) {
+            crc = (crc >> 8) ^ kTables[0][(crc ^ *p++) & 0xff];
+        }
+        return crc;
+    }
+
+#ifdef PQC_LEDGER_CRC32C_HW
+    PQC_LEDGER_TARGET_SSE42
+    uint32_t update_sse42(uint32_t crc, const uint8_t* p, size_t size) {
+        uint64_t crc64 = crc;
+        while (size >= 8) {
+            uint64_t word;
+            std::memcpy(&word, p, sizeof(word));
+            crc64 = _mm_crc32_u64(crc64, word);
+            p += 8;
+            size -= 8;
+        }
+        crc = static_cast<uint32_t>(crc64);
+        while (size-- > 0) {
+            crc = _mm_crc32_u8(crc, *p++);
+        }
+        return crc;
+    }
+#endif
+}
+
+uint32_t crc32c(ByteSpan data, uint32_t crc) noexcept {
+    crc = ~crc;
+#ifdef PQC_LEDGER_CRC32C_HW
+    static const bool hardware = util::cpu_features().sse42;
+    if (hardware) {
+        return ~update_sse42(crc, data.data(), data.size());
+    }
+#endif
+    return ~update_portable(crc, data.data(), data.size());
+}
+
+} // namespace pqc_ledger::codec
@@ -1,365 +1,420 @@
 #include "pqc_ledger/codec/decode.hpp"
+#include "pqc_ledger/codec/hex.hpp"
+#include "pqc_ledger/codec/base64.hpp"
 #include "pqc_ledger/types.hpp"
-#include "pqc_ledger/crypto/pq.hpp"
+#include "pqc_ledger/crypto/params.hpp"
+#include "codec/byte_order.hpp"
 #include <cstring>
-#include <stdexcept>
-#include <cctype>
 
 namespace pqc_ledger::codec {
 
 namespace {
+    // Reasons a decode can fail. Kept free of std::string so that rejecting
+    // malformed input never allocates; messages are only built on demand.
+    struct Failure {
+        ErrorCode code = ErrorCode::UnknownError;
+        const char* field = "";   // Field being decoded when the failure occurred
+        size_t expected = 0;
+        size_t actual = 0;
+    };
+    
+    // Bounds-checked big-endian reader. Every read reports failure through its
+    // return value instead of throwing.
     class Reader {
     public:
-        Reader(const std::vector<uint8_t>& data) : data_(data), pos_(0) {}
+        Reader(const uint8_t* data, size_t size) : data_(data), size_(size), pos_(0) {}
         
         bool has_bytes(size_t n) const {
-            return pos_ + n <= data_.size();
+            return n <= size_ - pos_;
         }
         
-        uint8_t read_u8() {
+        bool read_u8(uint8_t& out) {
             if (!has_bytes(1)) {
-                throw std::runtime_error("Unexpected end of data");
+                return false;
             }
-            return data_[pos_++];
+            out = data_[pos_++];
+            return true;
         }
         
-        uint16_t read_u16_be() {
+        bool read_u16_be(uint16_t& out) {
             if (!has_bytes(2)) {
-                throw std::runtime_error("Unexpected end of data");
+                return false;
             }
-            uint16_t value = (static_cast<uint16_t>(data_[pos_]) << 8) |
-                             static_cast<uint16_t>(data_[pos_ + 1]);
+            out = static_cast<uint16_t>((static_cast<uint16_t>(data_[pos_]) << 8) |
+                                        static_cast<uint16_t>(data_[pos_ + 1]));
             pos_ += 2;
-            return value;
+            return true;
         }
         
-        uint32_t read_u32_be() {
+        bool read_u32_be(uint32_t& out) {
             if (!has_bytes(4)) {
-                throw std::runtime_error("Unexpected end of data");
+                return false;
             }
-            uint32_t value = (static_cast<uint32_t>(data_[pos_]) << 24) |
-                             (static_cast<uint32_t>(data_[pos_ + 1]) << 16) |
-                             (static_cast<uint32_t>(data_[pos_ + 2]) << 8) |
-                             static_cast<uint32_t>(data_[pos_ + 3]);
+            out = (static_cast<uint32_t>(data_[pos_]) << 24) |
+                  (static_cast<uint32_t>(data_[pos_ + 1]) << 16) |
+                  (static_cast<uint32_t>(data_[pos_ + 2]) << 8) |
+                  static_cast<uint32_t>(data_[pos_ + 3]);
             pos_ += 4;
-            return value;
+            return true;
         }
         
-        uint64_t read_u64_be() {
+        bool read_u64_be(uint64_t& out) {
             if (!has_bytes(8)) {
-                throw std::runtime_error("Unexpected end of data");
+                return false;
             }
-            uint64_t value = (static_cast<uint64_t>(data_[pos_]) << 56) |
-                             (static_cast<uint64_t>(data_[pos_ + 1]) << 48) |
-                             (static_cast<uint64_t>(data_[pos_ + 2]) << 40) |
-                             (static_cast<uint64_t>(data_[pos_ + 3]) << 32) |
-                             (static_cast<uint64_t>(data_[pos_ + 4]) << 24) |
-                             (static_cast<uint64_t>(data_[pos_ + 5]) << 16) |
-                             (static_cast<uint64_t>(data_[pos_ + 6]) << 8) |
-                             static_cast<uint64_t>(data_[pos_ + 7]);
+            out = (static_cast<uint64_t>(data_[pos_]) << 56) |
+                  (static_cast<uint64_t>(data_[pos_ + 1]) << 48) |
+                  (static_cast<uint64_t>(data_[pos_ + 2]) << 40) |
+                  (static_cast<uint64_t>(data_[pos_ + 3]) << 32) |
+                  (static_cast<uint64_t>(data_[pos_ + 4]) << 24) |
+                  (static_cast<uint64_t>(data_[pos_ + 5]) << 16) |
+                  (static_cast<uint64_t>(data_[pos_ + 6]) << 8) |
+                  static_cast<uint64_t>(data_[pos_ + 7]);
             pos_ += 8;
-            return value;
+            return true;
         }
         
-        std::vector<uint8_t> read_bytes(size_t n) {
+        // Borrow the next n bytes without copying
+        bool read_bytes(size_t n, ByteSpan& out) {
             if (!has_bytes(n)) {
-                throw std::runtime_error("Unexpected end of data");
+                return false;
             }
-            std::vector<uint8_t> result(data_.begin() + pos_, data_.begin() + pos_ + n);
+            out = ByteSpan(data_ + pos_, n);
             pos_ += n;
-            return result;
+            return true;
         }
         
-        std::vector<uint8_t> read_bytes_with_len() {
-            uint16_t len = read_u16_be();
+        // Read len (u16 BE) || bytes. On failure, `failure` says whether the data
+        // ended inside the prefix or the prefix overruns the buffer.
+        bool read_bytes_with_len(const char* field, ByteSpan& out, Failure& failure) {
+            uint16_t len = 0;
+            if (!read_u16_be(len)) {
+                failure = Failure{ErrorCode::InvalidLengthPrefix, field, 2, remaining()};
+                return false;
+            }
             // Validate length doesn't exceed remaining buffer
             if (len > remaining()) {
-                throw std::runtime_error("LENGTH_PREFIX_MISMATCH:" + 
-                                        std::to_string(len) + " > " + 
-                                        std::to_string(remaining()));
+                failure = Failure{ErrorCode::MismatchedLength, field, len, remaining()};
+                return false;
             }
-            return read_bytes(len);
+            return read_bytes(len, out);
         }
         
         size_t remaining() const {
-            return data_.size() - pos_;
+            return size_ - pos_;
+        }
+        
+        size_t position() const {
+            return pos_;
         }
         
         bool at_end() const {
-            return pos_ >= data_.size();
+            return pos_ >= size_;
         }
         
     private:
-        const std::vector<uint8_t>& data_;
+        const uint8_t* data_;
+        size_t size_;
         size_t pos_;
     };
     
-    // Helper function to convert hex character to value
-    uint8_t hex_char_to_value(char c) {
-        if (c >= '0' && c <= '9') {
-            return static_cast<uint8_t>(c - '0');
-        } else if (c >= 'a' && c <= 'f') {
-            return static_cast<uint8_t>(c - 'a' + 10);
-        } else if (c >= 'A' && c <= 'F') {
-            return static_cast<uint8_t>(c - 'A' + 10);
-        }
-        throw std::runtime_error("Invalid hex character: " + std::string(1, c));
-    }
-    
-    // Decode hex string to bytes
-    std::vector<uint8_t> hex_to_bytes(const std::string& hex) {
-        // Remove whitespace
-        std::string clean_hex;
-        for (char c : hex) {
-            if (!std::isspace(static_cast<unsigned char>(c))) {
-                clean_hex += c;
-            }
-        }
-        
-        // Hex string must have even length
-        if (clean_hex.length() % 2 != 0) {
-            throw std::runtime_error("Hex string must have even length");
-        }
-        
-        std::vector<uint8_t> result;
-        result.reserve(clean_hex.length() / 2);
-        
-        for (size_t i = 0; i < clean_hex.length(); i += 2) {
-            uint8_t high = hex_char_to_value(clean_hex[i]);
-            uint8_t low = hex_char_to_value(clean_hex[i + 1]);
-            result.push_back((high << 4) | low);
-        }
-        
-        return result;
-    }
-    
-    // Base64 character to value mapping
-    uint8_t base64_char_to_value(char c) {
-        if (c >= 'A' && c <= 'Z') {
-            return static_cast<uint8_t>(c - 'A');
-        } else if (c >= 'a' && c <= 'z') {
-            return static_cast<uint8_t>(c - 'a' + 26);
-        } else if (c >= '0' && c <= '9') {
-            return static_cast<uint8_t>(c - '0' + 52);
-        } else if (c == '+') {
-            return 62;
-        } else if (c == '/') {
-            return 63;
-        } else if (c == '=') {
-            return 0; // Padding, but we'll handle it separately
-        }
-        throw std::runtime_error("Invalid base64 character: " + std::string(1, c));
+    Failure end_of_data(const char* field) {
+        return Failure{ErrorCode::InvalidLengthPrefix, field, 0, 0};
     }
     
-    // Decode base64 string to bytes
-    std::vector<uint8_t> base64_to_bytes(const std::string& base64) {
-        // Remove whitespace
-        std::string clean_base64;
-        for (char c : base64) {
-            if (!std::isspace(static_cast<unsigned char>(c))) {
-                clean_base64 += c;
-            }
-        }
-        
-        if (clean_base64.empty()) {
-            return std::vector<uint8_t>();
-        }
-        
-        // Calculate output size (base64 encodes 3 bytes as 4 characters)
-        size_t padding_count = 0;
-        if (clean_base64.length() > 0 && clean_base64[clean_base64.length() - 1] == '=') {
-            padding_count++;
-            if (clean_base64.length() > 1 && clean_base64[clean_base64.length() - 2] == '=') {
-                padding_count++;
-            }
-        }
-        
-        size_t output_size = (clean_base64.length() * 3) / 4 - padding_count;
-        std::vector<uint8_t> result;
-        result.reserve(output_size);
-        
-        // Process 4 characters at a time
-        for (size_t i = 0; i < clean_base64.length(); i += 4) {
-            if (i + 3 >= clean_base64.length()) {
-                throw std::runtime_error("Invalid base64 string: incomplete group");
-            }
-            
-            uint8_t b0 = base64_char_to_value(clean_base64[i]);
-            uint8_t b1 = base64_char_to_value(clean_base64[i + 1]);
-            uint8_t b2 = (i + 2 < clean_base64.length() && clean_base64[i + 2] != '=') 
-                         ? base64_char_to_value(clean_base64[i + 2]) : 0;
-            uint8_t b3 = (i + 3 < clean_base64.length() && clean_base64[i + 3] != '=') 
-                         ? base64_char_to_value(clean_base64[i + 3]) : 0;
-            
-            // Combine 4 base64 characters (6 bits each) into 3 bytes (8 bits each)
-            result.push_back((b0 << 2) | (b1 >> 4));
-            
-            if (clean_base64[i + 2] != '=') {
-                result.push_back((b1 << 4) | (b2 >> 2));
-            }
-            
-            if (clean_base64[i + 3] != '=') {
-                result.push_back((b2 << 6) | b3);
-            }
+    // Decoding core shared by every entry point. Never throws or allocates.
+    // Sizes come from the compile-time parameter table; decoding never enters liboqs.
+    template<typename Params>
+    bool decode_core(const uint8_t* data, size_t size, TransactionView& tx, Failure& failure) {
+        constexpr size_t kPubkeySize = Params::pubkey_size;
+        constexpr size_t kSignatureSize = Params::signature_size;
+        
+        if (data == nullptr || size == 0) {
+            failure = Failure{ErrorCode::InvalidTransaction, "transaction", 0, 0};
+            return false;
         }
         
-        return result;
-    }
-}
-
-Result<Transaction> decode(const std::vector<uint8_t>& data) {
-    if (data.empty()) {
-        return Result<Transaction>::Err(Error(ErrorCode::InvalidTransaction, "Empty transaction data"));
-    }
-    
-    try {
-        Reader reader(data);
-        
-        Transaction tx;
+        Reader reader(data, size);
         
         // Version (must be 1)
-        tx.version = reader.read_u8();
+        if (!reader.read_u8(tx.version)) {
+            failure = end_of_data("version");
+            return false;
+        }
         if (tx.version != 1) {
-            return Result<Transaction>::Err(Error(ErrorCode::InvalidVersion, 
-                "Version must be 1, got " + std::to_string(tx.version)));
+            failure = Failure{ErrorCode::InvalidVersion, "version", 1, tx.version};
+            return false;
         }
         
         // Chain ID
-        tx.chain_id = reader.read_u32_be();
+        if (!reader.read_u32_be(tx.chain_id)) {
+            failure = end_of_data("chain_id");
+            return false;
+        }
         
         // Nonce
-        tx.nonce = reader.read_u64_be();
+        if (!reader.read_u64_be(tx.nonce)) {
+            failure = end_of_data("nonce");
+            return false;
+        }
         
         // From pubkey (variable length)
-        tx.from_pubkey = reader.read_bytes_with_len();
-        
-        // Validate pubkey size matches expected algorithm size (default: ML-DSA-65, equivalent to Dilithium3)
-        // ML-DSA-65 pubkey size is 1952 bytes (same as Dilithium3)
-        constexpr size_t ML_DSA_65_PUBKEY_SIZE = 1952;
-        auto expected_pubkey_size = pqc_ledger::crypto::get_pubkey_size("ML-DSA-65");
-        size_t expected_size = ML_DSA_65_PUBKEY_SIZE;  // Default fallback
-        if (expected_pubkey_size.is_ok()) {
-            expected_size = expected_pubkey_size.value();
+        if (!reader.read_bytes_with_len("from_pubkey", tx.from_pubkey, failure)) {
+            return false;
         }
         
-        if (tx.from_pubkey.size() != expected_size) {
-            return Result<Transaction>::Err(Error(ErrorCode::InvalidPublicKey,
-                "Public key size mismatch: expected " + 
-                std::to_string(expected_size) + 
-                ", got " + std::to_string(tx.from_pubkey.size())));
+        // Validate pubkey size matches expected algorithm size (default: ML-DSA-65, equivalent to Dilithium3)
+        if (tx.from_pubkey.size() != kPubkeySize) {
+            failure = Failure{ErrorCode::InvalidPublicKey, "Public key", kPubkeySize,
+                              tx.from_pubkey.size()};
+            return false;
         }
         
         // To address (fixed 32 bytes)
-        tx.to = {};
-        auto to_bytes = reader.read_bytes(32);
+        ByteSpan to_bytes;
+        if (!reader.read_bytes(tx.to.size(), to_bytes)) {
+            failure = end_of_data("to");
+            return false;
+        }
         std::copy(to_bytes.begin(), to_bytes.end(), tx.to.begin());
         
         // Amount
-        tx.amount = reader.read_u64_be();
+        if (!reader.read_u64_be(tx.amount)) {
+            failure = end_of_data("amount");
+            return false;
+        }
         
         // Fee
-        tx.fee = reader.read_u64_be();
+        if (!reader.read_u64_be(tx.fee)) {
+            failure = end_of_data("fee");
+            return false;
+        }
+        tx.signed_bytes = ByteSpan(data, reader.position());
         
         // Auth tag
-        uint8_t auth_tag = reader.read_u8();
+        uint8_t auth_tag = 0;
+        if (!reader.read_u8(auth_tag)) {
+            failure = end_of_data("auth_tag");
+            return false;
+        }
+        
         if (auth_tag == 0) {
             tx.auth_mode = AuthMode::PqOnly;
-            auto sig_bytes = reader.read_bytes_with_len();
+            tx.classical_sig = ByteSpan();
+            if (!reader.read_bytes_with_len("pq_sig", tx.pq_sig, failure)) {
+                return false;
+            }
             
             // Allow empty signature for unsigned transactions (size 0)
             // Otherwise, validate PQ signature size matches expected algorithm size
-            if (sig_bytes.size() > 0) {
-                // ML-DSA-65 signature size is 3309 bytes
-                constexpr size_t ML_DSA_65_SIG_SIZE = 3309;
-                auto expected_sig_size = pqc_ledger::crypto::get_signature_size("ML-DSA-65");
-                size_t expected_size = ML_DSA_65_SIG_SIZE;  // Default fallback
-                if (expected_sig_size.is_ok()) {
-                    expected_size = expected_sig_size.value();
-                }
-                
-                if (sig_bytes.size() != expected_size) {
-                    return Result<Transaction>::Err(Error(ErrorCode::InvalidSignature,
-                        "PQ signature size mismatch: expected " + 
-                        std::to_string(expected_size) + 
-                        ", got " + std::to_string(sig_bytes.size())));
+            if (tx.pq_sig.size() > 0) {
+                if (tx.pq_sig.size() != kSignatureSize) {
+                    failure = Failure{ErrorCode::InvalidSignature, "PQ signature", kSignatureSize,
+                                      tx.pq_sig.size()};
+                    return false;
                 }
             }
-            
-            tx.auth = PqSignature{std::move(sig_bytes)};
         } else if (auth_tag == 1) {
             tx.auth_mode = AuthMode::Hybrid;
-            auto classical_sig = reader.read_bytes_with_len();
-            auto pq_sig = reader.read_bytes_with_len();
+            if (!reader.read_bytes_with_len("classical_sig", tx.classical_sig, failure) ||
+                !reader.read_bytes_with_len("pq_sig", tx.pq_sig, failure)) {
+                return false;
+            }
             
             // Validate Ed25519 signature size (must be 64 bytes)
-            if (classical_sig.size() != 64) {
-                return Result<Transaction>::Err(Error(ErrorCode::InvalidSignature,
-                    "Ed25519 signature size mismatch: expected 64, got " + 
-                    std::to_string(classical_sig.size())));
+            if (tx.classical_sig.size() != ED25519_SIG_SIZE) {
+                failure = Failure{ErrorCode::InvalidSignature, "Ed25519 signature", ED25519_SIG_SIZE,
+                                  tx.classical_sig.size()};
+                return false;
             }
             
             // Validate PQ signature size matches expected algorithm size (default: ML-DSA-65, equivalent to Dilithium3)
-            // ML-DSA-65 signature size is 3309 bytes
-            constexpr size_t ML_DSA_65_SIG_SIZE = 3309;
-            auto expected_sig_size = pqc_ledger::crypto::get_signature_size("ML-DSA-65");
-            size_t expected_size = ML_DSA_65_SIG_SIZE;  // Default fallback
-            if (expected_sig_size.is_ok()) {
-                expected_size = expected_sig_size.value();
+            if (tx.pq_sig.size() != kSignatureSize) {
+                failure = Failure{ErrorCode::InvalidSignature, "PQ signature", kSignatureSize,
+                                  tx.pq_sig.size()};
+                return false;
             }
-            
-            if (pq_sig.size() != expected_size) {
-                return Result<Transaction>::Err(Error(ErrorCode::InvalidSignature,
-                    "PQ signature size mismatch: expected " + 
-                    std::to_string(expected_size) + 
-                    ", got " + std::to_string(pq_sig.size())));
-            }
-            
-            tx.auth = HybridSignature{std::move(classical_sig), std::move(pq_sig)};
         } else {
-            return Result<Transaction>::Err(Error(ErrorCode::InvalidAuthTag,
-                "Invalid auth tag: " + std::to_string(auth_tag)));
+            failure = Failure{ErrorCode::InvalidAuthTag, "auth_tag", 1, auth_tag};
+            return false;
         }
         
         // Strict: no trailing bytes allowed
         if (!reader.at_end()) {
-            return Result<Transaction>::Err(Error(ErrorCode::TrailingBytes,
-                "Trailing bytes found: " + std::to_string(reader.remaining()) + " bytes"));
+            failure = Failure{ErrorCode::TrailingBytes, "transaction", 0, reader.remaining()};
+            return false;
         }
         
-        return Result<Transaction>::Ok(std::move(tx));
-        
-    } catch (const std::exception& e) {
-        std::string error_msg = e.what();
-        // Check for specific error types
-        if (error_msg.find("LENGTH_PREFIX_MISMATCH:") == 0) {
-            // Extract the length values from error message
-            return Result<Transaction>::Err(Error(ErrorCode::MismatchedLength, 
-                "Length prefix exceeds remaining buffer: " + error_msg.substr(23)));
+        return true;
+    }
+    
+    // Human-readable message for a failure (only built on the Result-returning paths)
+    Error to_error(const Failure& failure) {
+        std::string field = failure.field;
+        switch (failure.code) {
+        case ErrorCode::InvalidTransaction:
+            return Error(failure.code, "Empty transaction data");
+        case ErrorCode::InvalidVersion:
+            return Error(failure.code, "Version must be 1, got " + std::to_string(failure.actual));
+        case ErrorCode::InvalidPublicKey:
+        case ErrorCode::InvalidSignature:
+            return Error(failure.code, field + " size mismatch: expected " +
+                                           std::to_string(failure.expected) + ", got " +
+                                           std::to_string(failure.actual));
+        case ErrorCode::InvalidAuthTag:
+            return Error(failure.code, "Invalid auth tag: " + std::to_string(failure.actual));
+        case ErrorCode::TrailingBytes:
+            return Error(failure.code, "Trailing bytes found: " + std::to_string(failure.actual) +
+                                           " bytes");
+        case ErrorCode::MismatchedLength:
+            return Error(failure.code, "Length prefix exceeds remaining buffer: " +
+                                           std::to_string(failure.expected) + " > " +
+                                           std::to_string(failure.actual) + " (" + field + ")");
+        case ErrorCode::InvalidLengthPrefix:
+            return Error(failure.code, "Unexpected end of data while reading " + field);
+        default:
+            return Error(failure.code, "Invalid transaction");
         }
-        if (error_msg.find("Unexpected end of data") != std::string::npos) {
-            return Result<Transaction>::Err(Error(ErrorCode::InvalidLengthPrefix,
-                "Unexpected end of data while reading"));
+    }
+}
+
+bool try_decode_view(const uint8_t* data, size_t size, TransactionView& out,
+                     ErrorCode& error) noexcept {
+    Failure failure;
+    if (!decode_core<crypto::DefaultPqParams>(data, size, out, failure)) {
+        error = failure.code;
+        return false;
+    }
+    return true;
+}
+
+Result<TransactionView> decode_view(const uint8_t* data, size_t size) {
+    TransactionView tx;
+    Failure failure;
+    if (!decode_core<crypto::DefaultPqParams>(data, size, tx, failure)) {
+        return Result<TransactionView>::Err(to_error(failure));
+    }
+    return Result<TransactionView>::Ok(tx);
+}
+
+Result<TransactionView> decode_into(ByteSpan data, std::pmr::memory_resource* resource) {
+    auto view_result = decode_view(data.data(), data.size());
+    if (view_result.is_err()) {
+        return view_result;
+    }
+    
+    // Only accepted transactions are copied: one allocation holding the whole encoding
+    auto* copy = static_cast<uint8_t*>(resource->allocate(data.size(), alignof(uint8_t)));
+    std::memcpy(copy, data.data(), data.size());
+    
+    auto rebase = [&](ByteSpan field) {
+        if (field.empty()) {
+            return ByteSpan();
+        }
+        return ByteSpan(copy + (field.data() - data.data()), field.size());
+    };
+    TransactionView& view = view_result.value();
+    view.from_pubkey = rebase(view.from_pubkey);
+    view.pq_sig = rebase(view.pq_sig);
+    view.classical_sig = rebase(view.classical_sig);
+    view.signed_bytes = rebase(view.signed_bytes);
+    return view_result;
+}
+
+namespace {
+    using detail::load_u16_be;
+    using detail::load_u32_be;
+    using detail::load_u64_be;
+    
+    // Copy of a compile-time size in 32-byte moves. The fields sit at odd offsets in
+    // the encoding, and a library memcpy of a few KB between mutually misaligned
+    // buffers (rep movsb) measured about 3x slower than this.
+    template<size_t N>
+    void copy_fixed(uint8_t* out, const uint8_t* in) {
+        size_t i = 0;
+        for (; i + 32 <= N; i += 32) {
+            std::memcpy(out + i, in + i, 32);
         }
-        return Result<Transaction>::Err(Error(ErrorCode::InvalidTransaction, error_msg));
+        std::memcpy(out + i, in + i, N - i);
+    }
+}
+
+template<typename Params>
+Result<void> decode(ByteSpan data, BasicTransaction<Params>& out) {
+    using Tx = BasicTransaction<Params>;
+    const uint8_t* p = data.data();
+    
+    // A signed encoding for Params has one of two exact sizes, and then every
+    // length prefix is a known constant: check them all at fixed offsets.
+    const bool pq_only = data.size() == Tx::kPqOnlyEncodedSize;
+    const bool hybrid = data.size() == Tx::kHybridEncodedSize;
+    constexpr size_t kAuth = Tx::kAuthTagOffset;
+    const bool well_formed =
+        (pq_only || hybrid) && p[0] == 1 &&
+        load_u16_be(p + Tx::kPubkeyLenOffset) == Params::pubkey_size &&
+        (pq_only ? p[kAuth] == 0 && load_u16_be(p + kAuth + 1) == Params::signature_size
+                 : p[kAuth] == 1 && load_u16_be(p + kAuth + 1) == ED25519_SIG_SIZE &&
+                       load_u16_be(p + kAuth + 3 + ED25519_SIG_SIZE) == Params::signature_size);
+    
+    if (!well_formed) {
+        // Cold path: the general decoder for Params names the exact error
+        TransactionView view;
+        Failure failure;
+        if (!decode_core<Params>(p, data.size(), view, failure)) {
+            return Result<void>::Err(to_error(failure));
+        }
+        // Only an unsigned encoding (empty PQ signature) decodes but has no fixed form
+        return Result<void>::Err(Error(ErrorCode::InvalidSignature,
+            "PQ signature size mismatch: expected " + std::to_string(Params::signature_size) +
+            ", got 0"));
+    }
+    
+    out.version = p[0];
+    out.chain_id = load_u32_be(p + 1);
+    out.nonce = load_u64_be(p + 5);
+    copy_fixed<Params::pubkey_size>(out.from_pubkey.data(), p + Tx::kPubkeyOffset);
+    std::memcpy(out.to.data(), p + Tx::kToOffset, out.to.size());
+    out.amount = load_u64_be(p + Tx::kAmountOffset);
+    out.fee = load_u64_be(p + Tx::kFeeOffset);
+    if (hybrid) {
+        out.auth_mode = AuthMode::Hybrid;
+        std::memcpy(out.classical_sig.data(), p + kAuth + 3, ED25519_SIG_SIZE);
+        copy_fixed<Params::signature_size>(out.pq_sig.data(), p + kAuth + 5 + ED25519_SIG_SIZE);
+    } else {
+        out.auth_mode = AuthMode::PqOnly;
+        out.classical_sig.fill(0);
+        copy_fixed<Params::signature_size>(out.pq_sig.data(), p + kAuth + 3);
+    }
+    
+    return Result<void>::Ok();
+}
+
+template Result<void> decode(ByteSpan, BasicTransaction<crypto::MlDsa44>&);
+template Result<void> decode(ByteSpan, BasicTransaction<crypto::MlDsa65>&);
+template Result<void> decode(ByteSpan, BasicTransaction<crypto::MlDsa87>&);
+
+Result<Transaction> decode(const std::vector<uint8_t>& data) {
+    auto view_result = decode_view(data.data(), data.size());
+    if (view_result.is_err()) {
+        return Result<Transaction>::Err(view_result.error());
     }
+    return Result<Transaction>::Ok(view_result.value().to_transaction());
 }
 
 Result<Transaction> decode_from_hex(const std::string& hex) {
-    try {
-        auto bytes = hex_to_bytes(hex);
-        return decode(bytes);
-    } catch (const std::exception& e) {
-        return Result<Transaction>::Err(Error(ErrorCode::InvalidHexEncoding, e.what()));
+    auto bytes = hex_decode(hex);
+    if (bytes.is_err()) {
+        return Result<Transaction>::Err(bytes.error());
     }
+    return decode(bytes.value());
 }
 
 Result<Transaction> decode_from_base64(const std::string& base64) {
-    try {
-        auto bytes = base64_to_bytes(base64);
-        return decode(bytes);
-    } catch (const std::exception& e) {
-        return Result<Transaction>::Err(Error(ErrorCode::InvalidBase64Encoding, e.what()));
+    auto bytes = base64_decode(base64);
+    if (bytes.is_err()) {
+        return Result<Transaction>::Err(bytes.error());
     }
+    return decode(bytes.value());
 }
 
 } // namespace pqc_ledger::codec
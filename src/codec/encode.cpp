@@ -1,177 +1,365 @@
 #include "pqc_ledger/codec/encode.hpp"
+#include "pqc_ledger/codec/hex.hpp"
+#include "pqc_ledger/codec/base64.hpp"
 #include "pqc_ledger/types.hpp"
+#include <array>
 #include <cstring>
 #include <algorithm>
-#include <stdexcept>
-#include <sstream>
-#include <iomanip>
+#include <string>
 
 namespace pqc_ledger::codec {
 
 namespace {
-    void write_u8(std::vector<uint8_t>& out, uint8_t value) {
-        out.push_back(value);
-    }
+    // Field writers are templated over the output so the same code can write into a
+    // presized buffer or stream straight into a hasher.
+    struct PointerSink {
+        uint8_t* out;
+        void put(const uint8_t* data, size_t size) {
+            std::memcpy(out, data, size);
+            out += size;
+        }
+    };
+    
+    struct HashSink {
+        crypto::Sha256& hasher;
+        void put(const uint8_t* data, size_t size) { hasher.update(data, size); }
+    };
     
-    void write_u16_be(std::vector<uint8_t>& out, uint16_t value) {
-        out.push_back(static_cast<uint8_t>((value >> 8) & 0xFF));
-        out.push_back(static_cast<uint8_t>(value & 0xFF));
+    // Fixed-width stores: the byte arrays compile down to a byte swap and one store
+    template<typename Sink>
+    void write_u8(Sink& out, uint8_t value) {
+        out.put(&value, 1);
     }
     
-    void write_u32_be(std::vector<uint8_t>& out, uint32_t value) {
-        out.push_back(static_cast<uint8_t>((value >> 24) & 0xFF));
-        out.push_back(static_cast<uint8_t>((value >> 16) & 0xFF));
-        out.push_back(static_cast<uint8_t>((value >> 8) & 0xFF));
-        out.push_back(static_cast<uint8_t>(value & 0xFF));
+    template<typename Sink>
+    void write_u16_be(Sink& out, uint16_t value) {
+        const uint8_t bytes[2] = {static_cast<uint8_t>((value >> 8) & 0xFF),
+                                  static_cast<uint8_t>(value & 0xFF)};
+        out.put(bytes, sizeof(bytes));
     }
     
-    void write_u64_be(std::vector<uint8_t>& out, uint64_t value) {
-        out.push_back(static_cast<uint8_t>((value >> 56) & 0xFF));
-        out.push_back(static_cast<uint8_t>((value >> 48) & 0xFF));
-        out.push_back(static_cast<uint8_t>((value >> 40) & 0xFF));
-        out.push_back(static_cast<uint8_t>((value >> 32) & 0xFF));
-        out.push_back(static_cast<uint8_t>((value >> 24) & 0xFF));
-        out.push_back(static_cast<uint8_t>((value >> 16) & 0xFF));
-        out.push_back(static_cast<uint8_t>((value >> 8) & 0xFF));
-        out.push_back(static_cast<uint8_t>(value & 0xFF));
+    template<typename Sink>
+    void write_u32_be(Sink& out, uint32_t value) {
+        uint8_t bytes[4];
+        for (size_t i = 0; i < 4; ++i) {
+            bytes[i] = static_cast<uint8_t>((value >> (24 - 8 * i)) & 0xFF);
+        }
+        out.put(bytes, sizeof(bytes));
     }
     
-    void write_bytes_with_len(std::vector<uint8_t>& out, const std::vector<uint8_t>& bytes) {
-        if (bytes.size() > UINT16_MAX) {
-            throw std::runtime_error("Bytes length exceeds u16 max");
+    template<typename Sink>
+    void write_u64_be(Sink& out, uint64_t value) {
+        uint8_t bytes[8];
+        for (size_t i = 0; i < 8; ++i) {
+            bytes[i] = static_cast<uint8_t>((value >> (56 - 8 * i)) & 0xFF);
         }
+        out.put(bytes, sizeof(bytes));
+    }
+    
+    // Caller has checked bytes.size() <= UINT16_MAX (check_encodable)
+    template<typename Sink>
+    void write_bytes_with_len(Sink& out, ByteSpan bytes) {
         write_u16_be(out, static_cast<uint16_t>(bytes.size()));
-        out.insert(out.end(), bytes.begin(), bytes.end());
+        out.put(bytes.data(), bytes.size());
+    }
+    
+    // version + chain_id + nonce + pubkey len + to + amount + fee
+    constexpr size_t kUnsignedFixedSize = 1 + 4 + 8 + 2 + 32 + 8 + 8;
+    
+    size_t unsigned_fields_size(const Transaction& tx) {
+        return kUnsignedFixedSize + tx.from_pubkey.size();
+    }
+    
+    // Everything up to (not including) the auth tag; this is the signed part.
+    // Shared by Transaction and BasicTransaction, whose fields have the same names.
+    template<typename Sink, typename Tx>
+    void write_unsigned_fields(Sink& out, const Tx& tx) {
+        // Version
+        write_u8(out, tx.version);
+        
+        // Chain ID
+        write_u32_be(out, tx.chain_id);
+        
+        // Nonce
+        write_u64_be(out, tx.nonce);
+        
+        // From pubkey (variable length with prefix)
+        write_bytes_with_len(out, tx.from_pubkey);
+        
+        // To address (fixed 32 bytes, no length prefix)
+        out.put(tx.to.data(), tx.to.size());
+        
+        // Amount
+        write_u64_be(out, tx.amount);
+        
+        // Fee
+        write_u64_be(out, tx.fee);
+    }
+    
+    // Auth tag and payload
+    template<typename Sink>
+    void write_auth(Sink& out, const Transaction& tx) {
+        write_u8(out, static_cast<uint8_t>(tx.auth_mode));
+        if (tx.auth_mode == AuthMode::PqOnly) {
+            const auto& pq_sig = std::get<PqSignature>(tx.auth);
+            write_bytes_with_len(out, pq_sig.sig);
+        } else if (tx.auth_mode == AuthMode::Hybrid) {
+            const auto& hybrid_sig = std::get<HybridSignature>(tx.auth);
+            write_bytes_with_len(out, hybrid_sig.classical_sig);
+            write_bytes_with_len(out, hybrid_sig.pq_sig);
+        }
+    }
+    
+    template<typename Sink, typename Params>
+    void write_auth(Sink& out, const BasicTransaction<Params>& tx) {
+        write_u8(out, static_cast<uint8_t>(tx.auth_mode));
+        if (tx.auth_mode == AuthMode::Hybrid) {
+            write_bytes_with_len(out, tx.classical_sig);
+        }
+        write_bytes_with_len(out, tx.pq_sig);
+    }
+    
+    Result<void> check_unsigned_encodable(const Transaction& tx) {
+        if (tx.from_pubkey.size() > UINT16_MAX) {
+            return Result<void>::Err(Error(ErrorCode::InvalidPublicKey,
+                                           "Public key length exceeds u16 max"));
+        }
+        return Result<void>::Ok();
+    }
+    
+    // Checked before anything is written, so encoders never leave partial output
+    Result<void> check_encodable(const Transaction& tx) {
+        auto unsigned_check = check_unsigned_encodable(tx);
+        if (unsigned_check.is_err()) {
+            return unsigned_check;
+        }
+        
+        if (tx.auth_mode == AuthMode::PqOnly) {
+            const auto* pq_sig = std::get_if<PqSignature>(&tx.auth);
+            if (pq_sig == nullptr) {
+                return Result<void>::Err(Error(ErrorCode::InvalidAuthTag,
+                    "auth_mode is pq-only but auth holds a hybrid signature"));
+            }
+            if (pq_sig->sig.size() > UINT16_MAX) {
+                return Result<void>::Err(Error(ErrorCode::InvalidSignature,
+                                               "Signature length exceeds u16 max"));
+            }
+        } else if (tx.auth_mode == AuthMode::Hybrid) {
+            const auto* hybrid_sig = std::get_if<HybridSignature>(&tx.auth);
+            if (hybrid_sig == nullptr) {
+                return Result<void>::Err(Error(ErrorCode::InvalidAuthTag,
+                    "auth_mode is hybrid but auth holds a pq-only signature"));
+            }
+            if (hybrid_sig->classical_sig.size() > UINT16_MAX ||
+                hybrid_sig->pq_sig.size() > UINT16_MAX) {
+                return Result<void>::Err(Error(ErrorCode::InvalidSignature,
+                                               "Signature length exceeds u16 max"));
+            }
+        }
+        return Result<void>::Ok();
     }
 }
 
-Result<std::vector<uint8_t>> encode(const Transaction& tx) {
-    std::vector<uint8_t> out;
+size_t encoded_size(const Transaction& tx) {
+    size_t size = unsigned_fields_size(tx) + 1;  // + auth tag
     
-    // Version
-    write_u8(out, tx.version);
+    // Auth payload (a mismatched auth variant is rejected by the encoders)
+    const auto* pq_sig = std::get_if<PqSignature>(&tx.auth);
+    const auto* hybrid_sig = std::get_if<HybridSignature>(&tx.auth);
+    if (tx.auth_mode == AuthMode::PqOnly && pq_sig != nullptr) {
+        size += 2 + pq_sig->sig.size();
+    } else if (tx.auth_mode == AuthMode::Hybrid && hybrid_sig != nullptr) {
+        size += 2 + hybrid_sig->classical_sig.size() + 2 + hybrid_sig->pq_sig.size();
+    }
+    return size;
+}
+
+Result<size_t> encode_into(const Transaction& tx, MutableByteSpan out) {
+    auto check = check_encodable(tx);
+    if (check.is_err()) {
+        return Result<size_t>::Err(check.error());
+    }
     
-    // Chain ID
-    write_u32_be(out, tx.chain_id);
+    size_t size = encoded_size(tx);
+    if (out.size() < size) {
+        return Result<size_t>::Err(Error(ErrorCode::MismatchedLength,
+            "Output buffer too small: need " + std::to_string(size) + " bytes, have " +
+            std::to_string(out.size())));
+    }
     
-    // Nonce
-    write_u64_be(out, tx.nonce);
+    PointerSink sink{out.data()};
+    write_unsigned_fields(sink, tx);
+    write_auth(sink, tx);
     
-    // From pubkey (variable length with prefix)
-    write_bytes_with_len(out, tx.from_pubkey);
+    return Result<size_t>::Ok(size);
+}
+
+Result<void> encode_append(const Transaction& tx, std::vector<uint8_t>& out) {
+    auto check = check_encodable(tx);
+    if (check.is_err()) {
+        return check;
+    }
     
-    // To address (fixed 32 bytes, no length prefix)
-    out.insert(out.end(), tx.to.begin(), tx.to.end());
+    // One resize to the exact size, then direct stores
+    size_t start = out.size();
+    out.resize(start + encoded_size(tx));
+    PointerSink sink{out.data() + start};
+    write_unsigned_fields(sink, tx);
+    write_auth(sink, tx);
     
-    // Amount
-    write_u64_be(out, tx.amount);
+    return Result<void>::Ok();
+}
+
+Result<EncodedTransaction> encode_with_sighash(const Transaction& tx, uint32_t chain_id) {
+    auto check = check_encodable(tx);
+    if (check.is_err()) {
+        return Result<EncodedTransaction>::Err(check.error());
+    }
     
-    // Fee
-    write_u64_be(out, tx.fee);
+    EncodedTransaction result;
+    result.bytes.resize(encoded_size(tx));
+    PointerSink sink{result.bytes.data()};
+    write_unsigned_fields(sink, tx);
     
-    // Auth tag
-    write_u8(out, static_cast<uint8_t>(tx.auth_mode));
+    // The signed part is exactly what was just written; hash it while it is in cache
+    crypto::Sha256 hasher = crypto::begin_signing_message(chain_id);
+    hasher.update(result.bytes.data(), unsigned_fields_size(tx));
+    result.sighash = hasher.final();
     
-    // Auth payload
-    if (tx.auth_mode == AuthMode::PqOnly) {
-        const auto& pq_sig = std::get<PqSignature>(tx.auth);
-        write_bytes_with_len(out, pq_sig.sig);
-    } else if (tx.auth_mode == AuthMode::Hybrid) {
-        const auto& hybrid_sig = std::get<HybridSignature>(tx.auth);
-        write_bytes_with_len(out, hybrid_sig.classical_sig);
-        write_bytes_with_len(out, hybrid_sig.pq_sig);
+    write_auth(sink, tx);
+    
+    return Result<EncodedTransaction>::Ok(std::move(result));
+}
+
+Result<void> append_auth(const Transaction& tx, std::vector<uint8_t>& out) {
+    auto check = check_encodable(tx);
+    if (check.is_err()) {
+        return check;
     }
     
+    size_t start = out.size();
+    out.resize(start + encoded_size(tx) - unsigned_fields_size(tx));
+    PointerSink sink{out.data() + start};
+    write_auth(sink, tx);
+    
+    return Result<void>::Ok();
+}
+
+Result<std::vector<uint8_t>> encode(const Transaction& tx) {
+    std::vector<uint8_t> out;
+    auto append_result = encode_append(tx, out);
+    if (append_result.is_err()) {
+        return Result<std::vector<uint8_t>>::Err(append_result.error());
+    }
     return Result<std::vector<uint8_t>>::Ok(std::move(out));
 }
 
 Result<std::vector<uint8_t>> encode_for_signing(const Transaction& tx) {
+    // Note: No auth field - signatures are excluded
     std::vector<uint8_t> out;
+    auto append_result = append_for_signing(tx, out);
+    if (append_result.is_err()) {
+        return Result<std::vector<uint8_t>>::Err(append_result.error());
+    }
+    return Result<std::vector<uint8_t>>::Ok(std::move(out));
+}
+
+Result<void> append_for_signing(const Transaction& tx, std::vector<uint8_t>& out) {
+    auto check = check_unsigned_encodable(tx);
+    if (check.is_err()) {
+        return check;
+    }
     
-    // Version
-    write_u8(out, tx.version);
+    size_t start = out.size();
+    out.resize(start + unsigned_fields_size(tx));
+    PointerSink sink{out.data() + start};
+    write_unsigned_fields(sink, tx);
     
-    // Chain ID
-    write_u32_be(out, tx.chain_id);
+    return Result<void>::Ok();
+}
+
+Result<void> hash_for_signing(const Transaction& tx, crypto::Sha256& hasher) {
+    // Check up front so nothing is fed to the hasher for an unencodable transaction
+    auto check = check_unsigned_encodable(tx);
+    if (check.is_err()) {
+        return check;
+    }
     
-    // Nonce
-    write_u64_be(out, tx.nonce);
+    HashSink sink{hasher};
+    write_unsigned_fields(sink, tx);
     
-    // From pubkey (variable length with prefix)
-    write_bytes_with_len(out, tx.from_pubkey);
+    return Result<void>::Ok();
+}
+
+Result<void> hash_encoded(const Transaction& tx, crypto::Sha256& hasher) {
+    auto check = check_encodable(tx);
+    if (check.is_err()) {
+        return check;
+    }
     
-    // To address (fixed 32 bytes, no length prefix)
-    out.insert(out.end(), tx.to.begin(), tx.to.end());
+    HashSink sink{hasher};
+    write_unsigned_fields(sink, tx);
+    write_auth(sink, tx);
     
-    // Amount
-    write_u64_be(out, tx.amount);
+    return Result<void>::Ok();
+}
+
+template<typename Params>
+Result<size_t> encode_into(const BasicTransaction<Params>& tx, MutableByteSpan out) {
+    // Sizes are fixed by Params; only the auth mode can make the transaction unencodable
+    if (tx.auth_mode != AuthMode::PqOnly && tx.auth_mode != AuthMode::Hybrid) {
+        return Result<size_t>::Err(Error(ErrorCode::InvalidAuthTag, "Unknown auth mode"));
+    }
     
-    // Fee
-    write_u64_be(out, tx.fee);
+    size_t size = tx.encoded_size();
+    if (out.size() < size) {
+        return Result<size_t>::Err(Error(ErrorCode::MismatchedLength,
+            "Output buffer too small: need " + std::to_string(size) + " bytes, have " +
+            std::to_string(out.size())));
+    }
     
-    // Note: No auth field - signatures are excluded
+    PointerSink sink{out.data()};
+    write_unsigned_fields(sink, tx);
+    write_auth(sink, tx);
     
+    return Result<size_t>::Ok(size);
+}
+
+template<typename Params>
+Result<std::vector<uint8_t>> encode(const BasicTransaction<Params>& tx) {
+    std::vector<uint8_t> out(tx.encoded_size());
+    auto encode_result = encode_into(tx, out);
+    if (encode_result.is_err()) {
+        return Result<std::vector<uint8_t>>::Err(encode_result.error());
+    }
     return Result<std::vector<uint8_t>>::Ok(std::move(out));
 }
 
+template<typename Params>
+void hash_for_signing(const BasicTransaction<Params>& tx, crypto::Sha256& hasher) {
+    // The signed part has a fixed size; lay it out on the stack and hash it in one update
+    std::array<uint8_t, BasicTransaction<Params>::kUnsignedSize> unsigned_fields;
+    PointerSink sink{unsigned_fields.data()};
+    write_unsigned_fields(sink, tx);
+    hasher.update(unsigned_fields.data(), unsigned_fields.size());
+}
+
+template Result<size_t> encode_into(const BasicTransaction<crypto::MlDsa44>&, MutableByteSpan);
+template Result<size_t> encode_into(const BasicTransaction<crypto::MlDsa65>&, MutableByteSpan);
+template Result<size_t> encode_into(const BasicTransaction<crypto::MlDsa87>&, MutableByteSpan);
+template Result<std::vector<uint8_t>> encode(const BasicTransaction<crypto::MlDsa44>&);
+template Result<std::vector<uint8_t>> encode(const BasicTransaction<crypto::MlDsa65>&);
+template Result<std::vector<uint8_t>> encode(const BasicTransaction<crypto::MlDsa87>&);
+template void hash_for_signing(const BasicTransaction<crypto::MlDsa44>&, crypto::Sha256&);
+template void hash_for_signing(const BasicTransaction<crypto::MlDsa65>&, crypto::Sha256&);
+template void hash_for_signing(const BasicTransaction<crypto::MlDsa87>&, crypto::Sha256&);
+
 std::string encode_to_hex(const std::vector<uint8_t>& bytes) {
-    std::ostringstream oss;
-    oss << std::hex << std::setfill('0');
-    for (uint8_t byte : bytes) {
-        oss << std::setw(2) << static_cast<int>(byte);
-    }
-    return oss.str();
+    return hex_encode(bytes);
 }
 
 std::string encode_to_base64(const std::vector<uint8_t>& bytes) {
-    const char base64_chars[] = 
-        "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
-    
-    std::string result;
-    result.reserve(((bytes.size() + 2) / 3) * 4);
-    
-    size_t i = 0;
-    while (i < bytes.size()) {
-        // Get 3 bytes (24 bits)
-        size_t bytes_read = 0;
-        uint32_t b0 = 0, b1 = 0, b2 = 0;
-        
-        if (i < bytes.size()) {
-            b0 = bytes[i++];
-            bytes_read++;
-        }
-        if (i < bytes.size()) {
-            b1 = bytes[i++];
-            bytes_read++;
-        }
-        if (i < bytes.size()) {
-            b2 = bytes[i++];
-            bytes_read++;
-        }
-        
-        // Combine into 24-bit value
-        uint32_t combined = (b0 << 16) | (b1 << 8) | b2;
-        
-        // Extract 4 groups of 6 bits each
-        result += base64_chars[(combined >> 18) & 0x3F];
-        result += base64_chars[(combined >> 12) & 0x3F];
-        
-        // Third character: present if we have at least 2 bytes
-        if (bytes_read >= 2) {
-            result += base64_chars[(combined >> 6) & 0x3F];
-        } else {
-            result += '=';
-        }
-        
-        // Fourth character: present only if we have 3 bytes
-        if (bytes_read >= 3) {
-            result += base64_chars[combined & 0x3F];
-        } else {
-            result += '=';
-        }
-    }
-    
-    return result;
+    return base64_encode(bytes);
 }
 
 Result<std::string> encode_to_hex(const Transaction& tx) {
@@ -0,0 +1,226 @@
+#include "pqc_ledger/codec/hex.hpp"
+#include "codec/hex_backend.hpp"
+#include "util/cpu_features.hpp"
+#include <algorithm>
+#include <array>
+#include <string>
+
+namespace pqc_ledger::codec {
+
+namespace {
+    constexpr uint8_t kInvalid = 0xff;
+    constexpr uint8_t kSpace = 0xfe;
+
+    // Character -> nibble value, kSpace for ASCII whitespace (as std::isspace in
+    // the C locale), kInvalid for everything else
+    constexpr std::array<uint8_t, 256> make_decode_table() {
+        std::array<uint8_t, 256> table{};
+        for (size_t c = 0; c < 256; ++c) {
+            table[c] = kInvalid;
+        }
+        for (uint8_t i = 0; i < 10; ++i) {
+            table['0' + i] = i;
+        }
+        for (uint8_t i = 0; i < 6; ++i) {
+            table['a' + i] = static_cast<uint8_t>(10 + i);
+            table['A' + i] = static_cast<uint8_t>(10 + i);
+        }
+        for (char c : {' ', '\t', '\n', '\v', '\f', '\r'}) {
+            table[static_cast<uint8_t>(c)] = kSpace;
+        }
+        return table;
+    }
+
+    // Byte -> its two hex characters
+    constexpr std::array<char, 512> make_encode_table() {
+        constexpr char digits[] = "0123456789abcdef";
+        std::array<char, 512> table{};
+        for (size_t b = 0; b < 256; ++b) {
+            table[2 * b] = digits[b >> 4];
+            table[2 * b + 1] = digits[b & 0x0f];
+        }
+        return table;
+    }
+
+    constexpr std::array<uint8_t, 256> kDecodeTable = make_decode_table();
+    constexpr std::array<char, 512> kEncodeTable = make_encode_table();
+
+    // Characters handled by the scalar loop before the block kernel is retried
+    constexpr size_t kScalarRun = 64;
+
+    HexBackend select_backend() {
+        if (detail::hex_avx2_supported()) {
+            return HexBackend::Avx2;
+        }
+        if (detail::hex_ssse3_supported()) {
+            return HexBackend::Ssse3;
+        }
+        return HexBackend::Portable;
+    }
+
+    HexBackend usable(HexBackend backend) {
+        return hex_backend_available(backend) ? backend : HexBackend::Portable;
+    }
+
+    size_t encode_portable(const uint8_t* in, size_t size, char* out) {
+        for (size_t i = 0; i < size; ++i) {
+            out[2 * i] = kEncodeTable[2 * in[i]];
+            out[2 * i + 1] = kEncodeTable[2 * in[i] + 1];
+        }
+        return size;
+    }
+
+    // Portable block kernel: whole digit pairs until anything else shows up
+    size_t decode_pairs_portable(const char* in, size_t size, uint8_t* out, size_t out_size) {
+        size_t done = 0;
+        while (size - done >= 2 && done / 2 < out_size) {
+            uint8_t high = kDecodeTable[static_cast<uint8_t>(in[done])];
+            uint8_t low = kDecodeTable[static_cast<uint8_t>(in[done + 1])];
+            if ((high | low) > 0x0f) {
+                break;
+            }
+            out[done / 2] = static_cast<uint8_t>((high << 4) | low);
+            done += 2;
+        }
+        return done;
+    }
+
+    size_t decode_blocks(HexBackend backend, const char* in, size_t size, uint8_t* out,
+                         size_t out_size) {
+        switch (backend) {
+            case HexBackend::Avx2:
+                return detail::hex_decode_avx2(in, size, out, out_size);
+            case HexBackend::Ssse3:
+                return detail::hex_decode_ssse3(in, size, out, out_size);
+            case HexBackend::Portable:
+                break;
+        }
+        return decode_pairs_portable(in, size, out, out_size);
+    }
+}
+
+HexBackend hex_backend() {
+    static const HexBackend backend = select_backend();
+    return backend;
+}
+
+bool hex_backend_available(HexBackend backend) {
+    switch (backend) {
+        case HexBackend::Portable:
+            return true;
+        case HexBackend::Ssse3:
+            return detail::hex_ssse3_supported();
+        case HexBackend::Avx2:
+            return detail::hex_avx2_supported();
+    }
+    return false;
+}
+
+const char* hex_backend_name(HexBackend backend) {
+    switch (backend) {
+        case HexBackend::Portable:
+            return "portable";
+        case HexBackend::Ssse3:
+            return "ssse3";
+        case HexBackend::Avx2:
+            return "avx2";
+    }
+    return "unknown";
+}
+
+void hex_encode_into(ByteSpan bytes, char* out) noexcept {
+    hex_encode_into(bytes, out, hex_backend());
+}
+
+void hex_encode_into(ByteSpan bytes, char* out, HexBackend backend) noexcept {
+    const uint8_t* in = bytes.data();
+    const size_t size = bytes.size();
+
+    size_t done = 0;
+    switch (usable(backend)) {
+        case HexBackend::Avx2:
+            done = detail::hex_encode_avx2(in, size, out);
+            break;
+        case HexBackend::Ssse3:
+            done = detail::hex_encode_ssse3(in, size, out);
+            break;
+        case HexBackend::Portable:
+            break;
+    }
+    encode_portable(in + done, size - done, out + 2 * done);
+}
+
+std::string hex_encode(ByteSpan bytes) {
+    std::string result(hex_encoded_size(bytes.size()), '\0');
+    hex_encode_into(bytes, result.data());
+    return result;
+}
+
+Result<size_t> hex_decode_into(std::string_view hex, MutableByteSpan out) {
+    return hex_decode_into(hex, out, hex_backend());
+}
+
+Result<size_t> hex_decode_into(std::string_view hex, MutableByteSpan out, HexBackend backend) {
+    backend = usable(backend);
+    const char* in = hex.data();
+    const size_t size = hex.size();
+    uint8_t* dst = out.data();
+    const size_t capacity = out.size();
+
+    size_t pos = 0;
+    size_t written = 0;
+    uint8_t high = 0;
+    bool have_high = false;  // A digit is waiting for its partner across whitespace
+
+    while (pos < size) {
+        if (!have_high) {
+            size_t consumed = decode_blocks(backend, in + pos, size - pos, dst + written,
+                                            capacity - written);
+            pos += consumed;
+            written += consumed / 2;
+        }
+
+        // Whatever stopped the kernel: whitespace, an invalid character, a full
+        // output, or fewer characters than a block
+        const size_t stop = std::min(size, pos + kScalarRun);
+        for (; pos < stop; ++pos) {
+            uint8_t value = kDecodeTable[static_cast<uint8_t>(in[pos])];
+            if (value == kSpace) {
+                continue;
+            }
+            if (value == kInvalid) {
+                return Result<size_t>::Err(Error(ErrorCode::InvalidHexEncoding,
+                    "Invalid hex character at position " + std::to_string(pos)));
+            }
+            if (!have_high) {
+                high = value;
+                have_high = true;
+                continue;
+            }
+            if (written == capacity) {
+                return Result<size_t>::Err(Error(ErrorCode::MismatchedLength,
+                    "Hex output buffer too small: " + std::to_string(capacity) + " bytes"));
+            }
+            dst[written++] = static_cast<uint8_t>((high << 4) | value);
+            have_high = false;
+        }
+    }
+
+    if (have_high) {
+        return Result<size_t>::Err(Error(ErrorCode::InvalidHexEncoding,
+            "Hex string must have even length"));
+    }
+    return Result<size_t>::Ok(written);
+}
+
+Result<std::vector<uint8_t>> hex_decode(std::string_view hex) {
+    std::vector<uint8_t> bytes(hex.size() / 2);
+    auto written = hex_decode_into(hex, bytes);
+    if (written.is_err()) {
+        return Result<std::vector<uint8_t>>::Err(written.error());
+    }
+    bytes.resize(written.value());
+    return Result<std::vector<uint8_t>>::Ok(std::move(bytes));
+}
+
+} // namespace pqc_ledger::codec
@@ -0,0 +1,24 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace pqc_ledger::codec::detail {
+
+// Block kernels. Each converts as many whole blocks from the front of the input
+// as it can and returns the number of input units (bytes for encode, characters
+// for decode) it consumed; the caller finishes the rest with the scalar code.
+// Decoding stops before the first block that holds anything other than hex
+// digits, or that would not fit in out_size.
+
+// SSSE3: 16 bytes / 32 characters per block; only call when hex_ssse3_supported()
+size_t hex_encode_ssse3(const uint8_t* in, size_t size, char* out);
+size_t hex_decode_ssse3(const char* in, size_t size, uint8_t* out, size_t out_size);
+bool hex_ssse3_supported();
+
+// AVX2: 32 bytes / 64 characters per block; only call when hex_avx2_supported()
+size_t hex_encode_avx2(const uint8_t* in, size_t size, char* out);
+size_t hex_decode_avx2(const char* in, size_t size, uint8_t* out, size_t out_size);
+bool hex_avx2_supported();
+
+} // namespace pqc_ledger::codec::detail
@@ -0,0 +1,165 @@
+#include "codec/hex_backend.hpp"
+#include "util/cpu_features.hpp"
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#define PQC_LEDGER_HEX_SIMD 1
+#include <immintrin.h>
+#endif
+
+// Enabled per function like the SHA-256 kernels; callers check cpuid first
+#if defined(PQC_LEDGER_HEX_SIMD) && (defined(__GNUC__) || defined(__clang__))
+#define PQC_LEDGER_TARGET_SSSE3 __attribute__((target("ssse3")))
+#define PQC_LEDGER_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define PQC_LEDGER_TARGET_SSSE3
+#define PQC_LEDGER_TARGET_AVX2
+#endif
+
+namespace pqc_ledger::codec::detail {
+
+#ifdef PQC_LEDGER_HEX_SIMD
+
+namespace {
+    // Per character: nibble value in the low bits, and whether it is a hex digit
+    // at all. Unsigned range checks via min_epu8: x <= n  <=>  min(x, n) == x.
+    PQC_LEDGER_TARGET_SSSE3
+    inline __m128i nibbles_ssse3(__m128i chars, __m128i& valid) {
+        const __m128i digit = _mm_sub_epi8(chars, _mm_set1_epi8('0'));
+        const __m128i alpha = _mm_sub_epi8(_mm_or_si128(chars, _mm_set1_epi8(0x20)),
+                                           _mm_set1_epi8('a'));
+        const __m128i is_digit = _mm_cmpeq_epi8(_mm_min_epu8(digit, _mm_set1_epi8(9)), digit);
+        const __m128i is_alpha = _mm_cmpeq_epi8(_mm_min_epu8(alpha, _mm_set1_epi8(5)), alpha);
+        valid = _mm_or_si128(is_digit, is_alpha);
+        return _mm_or_si128(_mm_and_si128(is_digit, digit),
+                            _mm_andnot_si128(is_digit, _mm_add_epi8(alpha, _mm_set1_epi8(10))));
+    }
+
+    PQC_LEDGER_TARGET_AVX2
+    inline __m256i nibbles_avx2(__m256i chars, __m256i& valid) {
+        const __m256i digit = _mm256_sub_epi8(chars, _mm256_set1_epi8('0'));
+        const __m256i alpha = _mm256_sub_epi8(_mm256_or_si256(chars, _mm256_set1_epi8(0x20)),
+                                              _mm256_set1_epi8('a'));
+        const __m256i is_digit =
+            _mm256_cmpeq_epi8(_mm256_min_epu8(digit, _mm256_set1_epi8(9)), digit);
+        const __m256i is_alpha =
+            _mm256_cmpeq_epi8(_mm256_min_epu8(alpha, _mm256_set1_epi8(5)), alpha);
+        valid = _mm256_or_si256(is_digit, is_alpha);
+        return _mm256_blendv_epi8(_mm256_add_epi8(alpha, _mm256_set1_epi8(10)), digit, is_digit);
+    }
+}
+
+PQC_LEDGER_TARGET_SSSE3
+size_t hex_encode_ssse3(const uint8_t* in, size_t size, char* out) {
+    const __m128i digits = _mm_setr_epi8('0', '1', '2', '3', '4', '5', '6', '7',
+                                         '8', '9', 'a', 'b', 'c', 'd', 'e', 'f');
+    const __m128i low_nibble = _mm_set1_epi8(0x0f);
+
+    size_t done = 0;
+    for (; size - done >= 16; done += 16) {
+        const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + done));
+        const __m128i hi = _mm_shuffle_epi8(digits, _mm_and_si128(_mm_srli_epi16(bytes, 4),
+                                                                  low_nibble));
+        const __m128i lo = _mm_shuffle_epi8(digits, _mm_and_si128(bytes, low_nibble));
+        char* dst = out + 2 * done;
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), _mm_unpacklo_epi8(hi, lo));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 16), _mm_unpackhi_epi8(hi, lo));
+    }
+    return done;
+}
+
+PQC_LEDGER_TARGET_SSSE3
+size_t hex_decode_ssse3(const char* in, size_t size, uint8_t* out, size_t out_size) {
+    // pmaddubsw with weights (16, 1) folds each (high, low) digit pair into a byte
+    const __m128i weights = _mm_set1_epi16(0x0110);
+
+    size_t done = 0;
+    while (size - done >= 32 && out_size - done / 2 >= 16) {
+        __m128i valid0;
+        __m128i valid1;
+        const __m128i n0 = nibbles_ssse3(
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + done)), valid0);
+        const __m128i n1 = nibbles_ssse3(
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + done + 16)), valid1);
+        if (_mm_movemask_epi8(_mm_and_si128(valid0, valid1)) != 0xffff) {
+            break;
+        }
+        const __m128i bytes = _mm_packus_epi16(_mm_maddubs_epi16(n0, weights),
+                                               _mm_maddubs_epi16(n1, weights));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + done / 2), bytes);
+        done += 32;
+    }
+    return done;
+}
+
+bool hex_ssse3_supported() {
+    return util::cpu_features().ssse3;
+}
+
+PQC_LEDGER_TARGET_AVX2
+size_t hex_encode_avx2(const uint8_t* in, size_t size, char* out) {
+    const __m256i digits = _mm256_setr_epi8('0', '1', '2', '3', '4', '5', '6', '7',
+                                            '8', '9', 'a', 'b', 'c', 'd', 'e', 'f',
+                                            '0', '1', '2', '3', '4', '5', '6', '7',
+                                            '8', '9', 'a', 'b', 'c', 'd', 'e', 'f');
+    const __m256i low_nibble = _mm256_set1_epi8(0x0f);
+
+    size_t done = 0;
+    for (; size - done >= 32; done += 32) {
+        const __m256i bytes = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + done));
+        const __m256i hi = _mm256_shuffle_epi8(
+            digits, _mm256_and_si256(_mm256_srli_epi16(bytes, 4), low_nibble));
+        const __m256i lo = _mm256_shuffle_epi8(digits, _mm256_and_si256(bytes, low_nibble));
+        // Unpacking works per 128-bit lane: a holds bytes 0-7 and 16-23, b 8-15 and 24-31
+        const __m256i a = _mm256_unpacklo_epi8(hi, lo);
+        const __m256i b = _mm256_unpackhi_epi8(hi, lo);
+        char* dst = out + 2 * done;
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst), _mm256_permute2x128_si256(a, b, 0x20));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + 32),
+                            _mm256_permute2x128_si256(a, b, 0x31));
+    }
+    return done;
+}
+
+PQC_LEDGER_TARGET_AVX2
+size_t hex_decode_avx2(const char* in, size_t size, uint8_t* out, size_t out_size) {
+    const __m256i weights = _mm256_set1_epi16(0x0110);
+
+    size_t done = 0;
+    while (size - done >= 64 && out_size - done / 2 >= 32) {
+        __m256i valid0;
+        __m256i valid1;
+        const __m256i n0 = nibbles_avx2(
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + done)), valid0);
+        const __m256i n1 = nibbles_avx2(
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + done + 32)), valid1);
+        if (_mm256_movemask_epi8(_mm256_and_si256(valid0, valid1)) != -1) {
+            break;
+        }
+        // packus interleaves the two inputs per lane; restore byte order across lanes
+        const __m256i packed = _mm256_packus_epi16(_mm256_maddubs_epi16(n0, weights),
+                                                   _mm256_maddubs_epi16(n1, weights));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + done / 2),
+                            _mm256_permute4x64_epi64(packed, 0xd8));
+        done += 64;
+    }
+    return done;
+}
+
+bool hex_avx2_supported() {
+    return util::cpu_features().avx2;
+}
+
+#else
+
+// Never called: the *_supported() checks are false on this target
+size_t hex_encode_ssse3(const uint8_t*, size_t, char*) { return 0; }
+size_t hex_decode_ssse3(const char*, size_t, uint8_t*, size_t) { return 0; }
+bool hex_ssse3_supported() { return false; }
+
+size_t hex_encode_avx2(const uint8_t*, size_t, char*) { return 0; }
+size_t hex_decode_avx2(const char*, size_t, uint8_t*, size_t) { return 0; }
+bool hex_avx2_supported() { return false; }
+
+#endif
+
+} // namespace pqc_ledger::codec::detail
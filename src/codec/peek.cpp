@@ -0,0 +1,32 @@
+#include "pqc_ledger/codec/peek.hpp"
+#include "pqc_ledger/basic_transaction.hpp"
+#include "codec/byte_order.hpp"
+#include <cstring>
+
+namespace pqc_ledger::codec {
+
+bool peek(ByteSpan wire, TransactionHeader& out, ErrorCode& error) noexcept {
+    // Offsets hold for the default parameter set's key length, checked below
+    using Layout = FixedTransaction;
+    const uint8_t* p = wire.data();
+    
+    if (wire.size() <= Layout::kAuthTagOffset) {
+        error = ErrorCode::InvalidLengthPrefix;
+        return false;
+    }
+    if (detail::load_u16_be(p + Layout::kPubkeyLenOffset) != Layout::params::pubkey_size) {
+        error = ErrorCode::InvalidPublicKey;
+        return false;
+    }
+    
+    out.version = p[0];
+    out.chain_id = detail::load_u32_be(p + 1);
+    out.nonce = detail::load_u64_be(p + 5);
+    std::memcpy(out.to.data(), p + Layout::kToOffset, out.to.size());
+    out.amount = detail::load_u64_be(p + Layout::kAmountOffset);
+    out.fee = detail::load_u64_be(p + Layout::kFeeOffset);
+    out.auth_tag = p[Layout::kAuthTagOffset];
+    return true;
+}
+
+} // namespace pqc_ledger::codec
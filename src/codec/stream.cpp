@@ -0,0 +1,319 @@
+#include "pqc_ledger/codec/stream.hpp"
+#include "pqc_ledger/codec/encode.hpp"
+#include "pqc_ledger/codec/decode.hpp"
+#include "codec/byte_order.hpp"
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <string>
+#include <utility>
+
+#if defined(_WIN32)
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace pqc_ledger::codec {
+
+namespace {
+    constexpr uint8_t kMagic[4] = {'P', 'Q', 'T', 'S'};
+    constexpr size_t kLengthSize = 4;
+    constexpr size_t kChecksumSize = 4;
+
+    size_t record_size(size_t payload_size, bool checksums) {
+        return kLengthSize + payload_size + (checksums ? kChecksumSize : 0);
+    }
+
+    Error truncated(uint64_t offset) {
+        return Error(ErrorCode::InvalidLengthPrefix,
+                     "Stream ends inside the record at offset " + std::to_string(offset));
+    }
+
+    long read_some(int fd, uint8_t* out, size_t size) {
+#if defined(_WIN32)
+        return _read(fd, out, static_cast<unsigned>(std::min<size_t>(size, 1u << 30)));
+#else
+        return ::read(fd, out, size);
+#endif
+    }
+
+    long write_some(int fd, const uint8_t* data, size_t size) {
+#if defined(_WIN32)
+        return _write(fd, data, static_cast<unsigned>(std::min<size_t>(size, 1u << 30)));
+#else
+        return ::write(fd, data, size);
+#endif
+    }
+}
+
+ByteSource fd_source(int fd) {
+    return [fd](MutableByteSpan out) -> Result<size_t> {
+        while (true) {
+            long got = read_some(fd, out.data(), out.size());
+            if (got >= 0) {
+                return Result<size_t>::Ok(static_cast<size_t>(got));
+            }
+            if (errno != EINTR) {
+                return Result<size_t>::Err(Error(ErrorCode::FileReadError,
+                    std::string("read failed: ") + std::strerror(errno)));
+            }
+        }
+    };
+}
+
+ByteSink fd_sink(int fd) {
+    return [fd](ByteSpan data) -> Result<void> {
+        size_t done = 0;
+        while (done < data.size()) {
+            long put = write_some(fd, data.data() + done, data.size() - done);
+            if (put >= 0) {
+                done += static_cast<size_t>(put);
+            } else if (errno != EINTR) {
+                return Result<void>::Err(Error(ErrorCode::FileWriteError,
+                    std::string("write failed: ") + std::strerror(errno)));
+            }
+        }
+        return Result<void>::Ok();
+    };
+}
+
+ByteSink vector_sink(std::vector<uint8_t>& out) {
+    return [&out](ByteSpan data) -> Result<void> {
+        out.insert(out.end(), data.begin(), data.end());
+        return Result<void>::Ok();
+    };
+}
+
+TxStreamReader::TxStreamReader(ByteSpan data, const TxStreamReaderOptions& options)
+    : data_(data.data()),
+      begin_(0),
+      end_(data.size()),
+      source_done_(true),
+      options_(options),
+      header_read_(false),
+      checksums_(false),
+      records_read_(0),
+      offset_(0) {}
+
+TxStreamReader::TxStreamReader(ByteSource source, const TxStreamReaderOptions& options)
+    : source_(std::move(source)),
+      data_(nullptr),
+      begin_(0),
+      end_(0),
+      source_done_(false),
+      options_(options),
+      header_read_(false),
+      checksums_(false),
+      records_read_(0),
+      offset_(0) {}
+
+Result<bool> TxStreamReader::fill(size_t count) {
+    if (end_ - begin_ >= count || source_done_) {
+        return Result<bool>::Ok(end_ - begin_ >= count);
+    }
+
+    // Keep the unconsumed tail (less than one record) at the front of the buffer
+    if (begin_ > 0) {
+        std::memmove(buffer_.data(), buffer_.data() + begin_, end_ - begin_);
+        end_ -= begin_;
+        begin_ = 0;
+    }
+    size_t wanted = std::max(count, options_.buffer_size);
+    if (buffer_.size() < wanted) {
+        buffer_.resize(wanted);
+    }
+    data_ = buffer_.data();
+
+    while (end_ < count) {
+        auto got = source_(MutableByteSpan(buffer_.data() + end_, buffer_.size() - end_));
+        if (got.is_err()) {
+            return Result<bool>::Err(got.error());
+        }
+        if (got.value() == 0) {
+            source_done_ = true;
+            return Result<bool>::Ok(false);
+        }
+        end_ += got.value();
+    }
+    return Result<bool>::Ok(true);
+}
+
+Result<void> TxStreamReader::read_header() {
+    auto available = fill(TX_STREAM_HEADER_SIZE);
+    if (available.is_err()) {
+        return Result<void>::Err(available.error());
+    }
+    if (!available.value()) {
+        return Result<void>::Err(Error(ErrorCode::InvalidStreamHeader,
+            "Stream is shorter than its header"));
+    }
+
+    const uint8_t* header = data_ + begin_;
+    if (std::memcmp(header, kMagic, sizeof(kMagic)) != 0) {
+        return Result<void>::Err(Error(ErrorCode::InvalidStreamHeader,
+            "Not a transaction stream (bad magic)"));
+    }
+    if (header[4] != TX_STREAM_VERSION) {
+        return Result<void>::Err(Error(ErrorCode::InvalidStreamHeader,
+            "Unsupported stream version: " + std::to_string(header[4])));
+    }
+    if ((header[5] & ~TX_STREAM_FLAG_CHECKSUMS) != 0 || header[6] != 0 || header[7] != 0) {
+        return Result<void>::Err(Error(ErrorCode::InvalidStreamHeader,
+            "Unknown stream flags"));
+    }
+
+    checksums_ = (header[5] & TX_STREAM_FLAG_CHECKSUMS) != 0;
+    header_read_ = true;
+    begin_ += TX_STREAM_HEADER_SIZE;
+    offset_ += TX_STREAM_HEADER_SIZE;
+    return Result<void>::Ok();
+}
+
+Result<bool> TxStreamReader::next_record(ByteSpan& payload) {
+    if (!header_read_) {
+        auto header = read_header();
+        if (header.is_err()) {
+            return Result<bool>::Err(header.error());
+        }
+    }
+
+    auto available = fill(kLengthSize);
+    if (available.is_err()) {
+        return available;
+    }
+    if (!available.value()) {
+        if (end_ == begin_) {
+            return Result<bool>::Ok(false);
+        }
+        return Result<bool>::Err(truncated(offset_));
+    }
+
+    const size_t length = detail::load_u32_be(data_ + begin_);
+    if (length == 0 || length > options_.max_record_size) {
+        return Result<bool>::Err(Error(ErrorCode::InvalidLengthPrefix,
+            "Record length " + std::to_string(length) + " at offset " +
+            std::to_string(offset_) + " is outside 1.." +
+            std::to_string(options_.max_record_size)));
+    }
+
+    const size_t total = record_size(length, checksums_);
+    available = fill(total);
+    if (available.is_err()) {
+        return available;
+    }
+    if (!available.value()) {
+        return Result<bool>::Err(truncated(offset_));
+    }
+
+    const uint8_t* record = data_ + begin_;
+    ByteSpan body(record + kLengthSize, length);
+    if (checksums_) {
+        uint32_t expected = detail::load_u32_be(record + kLengthSize + length);
+        if (crc32c(body) != expected) {
+            return Result<bool>::Err(Error(ErrorCode::ChecksumMismatch,
+                "Checksum mismatch in the record at offset " + std::to_string(offset_)));
+        }
+    }
+
+    payload = body;
+    begin_ += total;
+    offset_ += total;
+    ++records_read_;
+    return Result<bool>::Ok(true);
+}
+
+Result<bool> TxStreamReader::next(TransactionView& out) {
+    ByteSpan payload;
+    auto more = next_record(payload);
+    if (more.is_err() || !more.value()) {
+        return more;
+    }
+    auto view = decode_view(payload.data(), payload.size());
+    if (view.is_err()) {
+        return Result<bool>::Err(view.error());
+    }
+    out = view.value();
+    return Result<bool>::Ok(true);
+}
+
+TxStreamWriter::TxStreamWriter(ByteSink sink, const TxStreamWriterOptions& options)
+    : sink_(std::move(sink)), options_(options), records_written_(0) {
+    buffer_.reserve(std::max(options_.buffer_size, TX_STREAM_HEADER_SIZE));
+    buffer_.insert(buffer_.end(), std::begin(kMagic), std::end(kMagic));
+    buffer_.push_back(TX_STREAM_VERSION);
+    buffer_.push_back(options_.checksums ? TX_STREAM_FLAG_CHECKSUMS : 0);
+    buffer_.push_back(0);
+    buffer_.push_back(0);
+}
+
+TxStreamWriter::~TxStreamWriter() {
+    flush();
+}
+
+Result<size_t> TxStreamWriter::begin_record(size_t payload_size) {
+    if (payload_size == 0 || payload_size > UINT32_MAX) {
+        return Result<size_t>::Err(Error(ErrorCode::InvalidLengthPrefix,
+            "Record payload must be 1 byte to 4 GiB - 1, got " + std::to_string(payload_size)));
+    }
+    const size_t total = record_size(payload_size, options_.checksums);
+    if (!buffer_.empty() && buffer_.size() + total > options_.buffer_size) {
+        auto flushed = flush();
+        if (flushed.is_err()) {
+            return Result<size_t>::Err(flushed.error());
+        }
+    }
+    const size_t start = buffer_.size();
+    buffer_.resize(start + total);
+    return Result<size_t>::Ok(start);
+}
+
+void TxStreamWriter::end_record(size_t start, size_t payload_size) {
+    uint8_t* record = buffer_.data() + start;
+    detail::store_u32_be(record, static_cast<uint32_t>(payload_size));
+    if (options_.checksums) {
+        uint32_t crc = crc32c(ByteSpan(record + kLengthSize, payload_size));
+        detail::store_u32_be(record + kLengthSize + payload_size, crc);
+    }
+    ++records_written_;
+}
+
+Result<void> TxStreamWriter::write(const Transaction& tx) {
+    const size_t payload_size = encoded_size(tx);
+    auto start = begin_record(payload_size);
+    if (start.is_err()) {
+        return Result<void>::Err(start.error());
+    }
+    auto written = encode_into(tx, MutableByteSpan(buffer_.data() + start.value() + kLengthSize,
+                                                   payload_size));
+    if (written.is_err()) {
+        buffer_.resize(start.value());
+        return Result<void>::Err(written.error());
+    }
+    end_record(start.value(), payload_size);
+    return Result<void>::Ok();
+}
+
+Result<void> TxStreamWriter::write_record(ByteSpan payload) {
+    auto start = begin_record(payload.size());
+    if (start.is_err()) {
+        return Result<void>::Err(start.error());
+    }
+    std::memcpy(buffer_.data() + start.value() + kLengthSize, payload.data(), payload.size());
+    end_record(start.value(), payload.size());
+    return Result<void>::Ok();
+}
+
+Result<void> TxStreamWriter::flush() {
+    if (buffer_.empty()) {
+        return Result<void>::Ok();
+    }
+    auto sent = sink_(buffer_);
+    if (sent.is_err()) {
+        return sent;
+    }
+    buffer_.clear();
+    return Result<void>::Ok();
+}
+
+} // namespace pqc_ledger::codec
@@ -1,36 +1,25 @@
 #include "pqc_ledger/crypto/address.hpp"
 #include "pqc_ledger/crypto/hash.hpp"
-#include <sstream>
-#include <iomanip>
-#include <stdexcept>
+#include "pqc_ledger/codec/hex.hpp"
 
 namespace pqc_ledger::crypto {
 
 Result<Address> derive_address(const PublicKey& pubkey) {
-    // Address = first_32_bytes(SHA256(from_pubkey_bytes))
+    // Address = first_32_bytes(SHA256(from_pubkey_bytes)); the digest is exactly 32 bytes
     auto hash_result = sha256(pubkey);
     if (hash_result.is_err()) {
         return Result<Address>::Err(hash_result.error());
     }
-    
-    const auto& hash = hash_result.value();
-    if (hash.size() < 32) {
-        return Result<Address>::Err(Error(ErrorCode::HashError, "Hash too short"));
-    }
-    
-    Address addr;
-    std::copy(hash.begin(), hash.begin() + 32, addr.begin());
-    
-    return Result<Address>::Ok(addr);
+    return Result<Address>::Ok(hash_result.value());
+}
+
+Result<void> derive_addresses(Span<const ByteSpan> pubkeys, Span<Address> addresses) {
+    // Address is exactly one SHA-256 digest, so the hashes land in place
+    return sha256_many(pubkeys, addresses);
 }
 
 std::string address_to_hex(const Address& addr) {
-    std::ostringstream oss;
-    oss << std::hex << std::setfill('0');
-    for (uint8_t byte : addr) {
-        oss << std::setw(2) << static_cast<int>(byte);
-    }
-    return oss.str();
+    return codec::hex_encode(addr);
 }
 
 Result<Address> address_from_hex(const std::string& hex) {
@@ -40,14 +29,14 @@ Result<Address> address_from_hex(const std::string& hex) {
     }
     
     Address addr;
-    for (size_t i = 0; i < 32; ++i) {
-        std::string byte_str = hex.substr(i * 2, 2);
-        try {
-            addr[i] = static_cast<uint8_t>(std::stoul(byte_str, nullptr, 16));
-        } catch (...) {
-            return Result<Address>::Err(Error(ErrorCode::InvalidHexEncoding,
-                "Invalid hex character at position " + std::to_string(i * 2)));
-        }
+    auto written = codec::hex_decode_into(hex, addr);
+    if (written.is_err()) {
+        return Result<Address>::Err(written.error());
+    }
+    // Whitespace is skipped by the decoder, so 64 characters may hold fewer digits
+    if (written.value() != addr.size()) {
+        return Result<Address>::Err(Error(ErrorCode::InvalidHexEncoding,
+            "Hex string must be 64 hex digits (32 bytes)"));
     }
     
     return Result<Address>::Ok(addr);
@@ -149,7 +149,7 @@ Result<void> save_ed25519_private_key(const std::vector<uint8_t>& privkey, const
 #endif
 }
 
-Result<Signature> ed25519_sign(const std::vector<uint8_t>& message,
+Result<Signature> ed25519_sign(ByteSpan message,
                                 const std::vector<uint8_t>& privkey) {
 #ifdef HAVE_OPENSSL
     if (privkey.size() != ED25519_PRIVATE_KEY_LEN) {
@@ -190,9 +190,9 @@ Result<Signature> ed25519_sign(const std::vector<uint8_t>& message,
 #endif
 }
 
-Result<bool> ed25519_verify(const std::vector<uint8_t>& message,
-                            const Signature& signature,
-                            const PublicKey& pubkey) {
+Result<bool> ed25519_verify(ByteSpan message,
+                            ByteSpan signature,
+                            ByteSpan pubkey) {
 #ifdef HAVE_OPENSSL
     if (pubkey.size() != ED25519_PUBKEY_SIZE) {
         return Result<bool>::Err(Error(ErrorCode::InvalidPublicKey, "Invalid Ed25519 public key size"));
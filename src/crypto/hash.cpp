@@ -1,48 +1,334 @@
 #include "pqc_ledger/crypto/hash.hpp"
-#include "picosha2.h"
+#include "crypto/sha256_backend.hpp"
+#include <algorithm>
 #include <cstring>
 
+#ifdef HAVE_OPENSSL
+#include <openssl/evp.h>
+#endif
+
 namespace pqc_ledger::crypto {
 
-Result<std::vector<uint8_t>> sha256(const std::vector<uint8_t>& data) {
-    std::vector<uint8_t> hash(32);  // SHA256 produces 32 bytes
-    picosha2::hash256(data.begin(), data.end(), hash.begin(), hash.end());
-    return Result<std::vector<uint8_t>>::Ok(std::move(hash));
+namespace detail {
+
+const uint32_t kSha256RoundConstants[64] = {
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5,
+    0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+    0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3,
+    0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+    0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc,
+    0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7,
+    0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+    0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13,
+    0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+    0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3,
+    0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5,
+    0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+    0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208,
+    0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2};
+
+namespace {
+    inline uint32_t rotr(uint32_t x, unsigned n) {
+        return (x >> n) | (x << (32 - n));
+    }
+    
+    inline uint32_t load_u32_be(const uint8_t* p) {
+        return (static_cast<uint32_t>(p[0]) << 24) | (static_cast<uint32_t>(p[1]) << 16) |
+               (static_cast<uint32_t>(p[2]) << 8) | static_cast<uint32_t>(p[3]);
+    }
+    
+    // One SHA-256 compression over a 64-byte block (FIPS 180-4, section 6.2.2)
+    void compress_block(uint32_t state[8], const uint8_t* block) {
+        uint32_t w[64];
+        for (size_t i = 0; i < 16; ++i) {
+            w[i] = load_u32_be(block + 4 * i);
+        }
+        for (size_t i = 16; i < 64; ++i) {
+            uint32_t s0 = rotr(w[i - 15], 7) ^ rotr(w[i - 15], 18) ^ (w[i - 15] >> 3);
+            uint32_t s1 = rotr(w[i - 2], 17) ^ rotr(w[i - 2], 19) ^ (w[i - 2] >> 10);
+            w[i] = w[i - 16] + s0 + w[i - 7] + s1;
+        }
+        
+        uint32_t a = state[0], b = state[1], c = state[2], d = state[3];
+        uint32_t e = state[4], f = state[5], g = state[6], h = state[7];
+        for (size_t i = 0; i < 64; ++i) {
+            uint32_t s1 = rotr(e, 6) ^ rotr(e, 11) ^ rotr(e, 25);
+            uint32_t ch = (e & f) ^ (~e & g);
+            uint32_t t1 = h + s1 + ch + kSha256RoundConstants[i] + w[i];
+            uint32_t s0 = rotr(a, 2) ^ rotr(a, 13) ^ rotr(a, 22);
+            uint32_t maj = (a & b) ^ (a & c) ^ (b & c);
+            uint32_t t2 = s0 + maj;
+            h = g;
+            g = f;
+            f = e;
+            e = d + t1;
+            d = c;
+            c = b;
+            b = a;
+            a = t1 + t2;
+        }
+        
+        state[0] += a;
+        state[1] += b;
+        state[2] += c;
+        state[3] += d;
+        state[4] += e;
+        state[5] += f;
+        state[6] += g;
+        state[7] += h;
+    }
 }
 
-Result<std::vector<uint8_t>> sha256_concat(const std::vector<std::vector<uint8_t>>& parts) {
-    // Concatenate all parts into a single vector
-    std::vector<uint8_t> concatenated;
-    for (const auto& part : parts) {
-        concatenated.insert(concatenated.end(), part.begin(), part.end());
+void sha256_compress_portable(uint32_t state[8], const uint8_t* blocks, size_t num_blocks) {
+    for (; num_blocks > 0; --num_blocks, blocks += 64) {
+        compress_block(state, blocks);
     }
+}
+
+} // namespace detail
+
+namespace {
+    const uint32_t kInitialState[8] = {0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
+                                       0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19};
     
-    // Hash the concatenated data
-    std::vector<uint8_t> hash(32);  // SHA256 produces 32 bytes
-    picosha2::hash256(concatenated.begin(), concatenated.end(), hash.begin(), hash.end());
-    return Result<std::vector<uint8_t>>::Ok(std::move(hash));
+    detail::Sha256CompressFn block_function(Sha256Backend backend) {
+        if (backend == Sha256Backend::ShaNi && detail::sha256_shani_supported()) {
+            return detail::sha256_compress_shani;
+        }
+        if (backend == Sha256Backend::Portable) {
+            return detail::sha256_compress_portable;
+        }
+        // OpenSsl has no block interface we can drive: use the best block function
+        return detail::sha256_shani_supported() ? detail::sha256_compress_shani
+                                                : detail::sha256_compress_portable;
+    }
+    
+    Sha256Backend select_backend() {
+        if (detail::sha256_shani_supported()) {
+            return Sha256Backend::ShaNi;
+        }
+#ifdef HAVE_OPENSSL
+        // OpenSSL carries its own SSSE3/AVX/AVX2 assembly
+        return Sha256Backend::OpenSsl;
+#else
+        return Sha256Backend::Portable;
+#endif
+    }
+    
+    Sha256Backend select_many_backend() {
+        // Eight scalar lanes lose to one SHA-NI or OpenSSL stream
+        if (detail::sha256_avx2_supported() && sha256_backend() == Sha256Backend::Portable) {
+            return Sha256Backend::Avx2;
+        }
+        return sha256_backend();
+    }
 }
 
-Result<std::vector<uint8_t>> create_signing_message(uint32_t chain_id,
-                                                     const std::vector<uint8_t>& tx_data) {
-    // Format: SHA256("TXv1" || chain_id_be || canonical_encode(tx_without_sigs))
-    const std::string domain_prefix = "TXv1";
+Sha256Backend sha256_backend() {
+    static const Sha256Backend backend = select_backend();
+    return backend;
+}
+
+bool sha256_backend_available(Sha256Backend backend) {
+    switch (backend) {
+        case Sha256Backend::Portable:
+            return true;
+        case Sha256Backend::ShaNi:
+            return detail::sha256_shani_supported();
+        case Sha256Backend::OpenSsl:
+#ifdef HAVE_OPENSSL
+            return true;
+#else
+            return false;
+#endif
+        case Sha256Backend::Avx2:
+            return detail::sha256_avx2_supported();
+    }
+    return false;
+}
+
+const char* sha256_backend_name(Sha256Backend backend) {
+    switch (backend) {
+        case Sha256Backend::Portable:
+            return "portable";
+        case Sha256Backend::ShaNi:
+            return "sha-ni";
+        case Sha256Backend::OpenSsl:
+            return "openssl";
+        case Sha256Backend::Avx2:
+            return "avx2-x8";
+    }
+    return "unknown";
+}
+
+Sha256::Sha256() noexcept : Sha256(sha256_backend()) {}
+
+Sha256::Sha256(Sha256Backend backend) noexcept : compress_(block_function(backend)) {
+    reset();
+}
+
+void Sha256::reset() noexcept {
+    std::memcpy(state_, kInitialState, sizeof(state_));
+    buffer_len_ = 0;
+    total_len_ = 0;
+}
+
+Sha256& Sha256::update(const uint8_t* data, size_t size) noexcept {
+    total_len_ += size;
     
-    // Convert chain_id to big-endian bytes
-    std::vector<uint8_t> chain_id_be(4);
-    chain_id_be[0] = static_cast<uint8_t>((chain_id >> 24) & 0xFF);
-    chain_id_be[1] = static_cast<uint8_t>((chain_id >> 16) & 0xFF);
-    chain_id_be[2] = static_cast<uint8_t>((chain_id >> 8) & 0xFF);
-    chain_id_be[3] = static_cast<uint8_t>(chain_id & 0xFF);
+    // Top up a partially filled block first
+    if (buffer_len_ > 0) {
+        size_t take = std::min(size, BLOCK_SIZE - buffer_len_);
+        std::memcpy(buffer_ + buffer_len_, data, take);
+        buffer_len_ += take;
+        data += take;
+        size -= take;
+        if (buffer_len_ < BLOCK_SIZE) {
+            return *this;
+        }
+        compress_(state_, buffer_, 1);
+        buffer_len_ = 0;
+    }
     
-    // Concatenate: "TXv1" || chain_id_be || tx_data
-    std::vector<std::vector<uint8_t>> parts;
-    parts.push_back(std::vector<uint8_t>(domain_prefix.begin(), domain_prefix.end()));
-    parts.push_back(std::move(chain_id_be));
-    parts.push_back(tx_data);
+    // Whole blocks straight from the input
+    if (size >= BLOCK_SIZE) {
+        size_t num_blocks = size / BLOCK_SIZE;
+        compress_(state_, data, num_blocks);
+        data += num_blocks * BLOCK_SIZE;
+        size -= num_blocks * BLOCK_SIZE;
+    }
     
-    return sha256_concat(parts);
+    if (size > 0) {
+        std::memcpy(buffer_, data, size);
+        buffer_len_ = size;
+    }
+    return *this;
 }
 
-} // namespace pqc_ledger::crypto
+Hash32 Sha256::final() noexcept {
+    // Padding: 0x80, zeros, then the message length in bits (u64 BE)
+    uint64_t bit_len = total_len_ * 8;
+    buffer_[buffer_len_++] = 0x80;
+    if (buffer_len_ > BLOCK_SIZE - 8) {
+        std::memset(buffer_ + buffer_len_, 0, BLOCK_SIZE - buffer_len_);
+        compress_(state_, buffer_, 1);
+        buffer_len_ = 0;
+    }
+    std::memset(buffer_ + buffer_len_, 0, BLOCK_SIZE - 8 - buffer_len_);
+    for (size_t i = 0; i < 8; ++i) {
+        buffer_[BLOCK_SIZE - 1 - i] = static_cast<uint8_t>(bit_len >> (8 * i));
+    }
+    compress_(state_, buffer_, 1);
+    buffer_len_ = 0;
+    
+    Hash32 digest;
+    for (size_t i = 0; i < 8; ++i) {
+        digest[i * 4] = static_cast<uint8_t>(state_[i] >> 24);
+        digest[i * 4 + 1] = static_cast<uint8_t>(state_[i] >> 16);
+        digest[i * 4 + 2] = static_cast<uint8_t>(state_[i] >> 8);
+        digest[i * 4 + 3] = static_cast<uint8_t>(state_[i]);
+    }
+    return digest;
+}
+
+std::array<uint8_t, SIGNING_PREFIX_SIZE> signing_message_prefix(uint32_t chain_id) {
+    return {'T', 'X', 'v', '1',
+            static_cast<uint8_t>((chain_id >> 24) & 0xFF),
+            static_cast<uint8_t>((chain_id >> 16) & 0xFF),
+            static_cast<uint8_t>((chain_id >> 8) & 0xFF),
+            static_cast<uint8_t>(chain_id & 0xFF)};
+}
+
+Sha256 begin_signing_message(uint32_t chain_id) {
+    const auto prefix = signing_message_prefix(chain_id);
+    Sha256 hasher;
+    hasher.update(prefix.data(), prefix.size());
+    return hasher;
+}
+
+Result<Hash32> sha256(ByteSpan data, Sha256Backend backend) {
+    if (!sha256_backend_available(backend)) {
+        return Result<Hash32>::Err(Error(ErrorCode::HashError,
+            std::string("SHA-256 backend not available: ") + sha256_backend_name(backend)));
+    }
+    
+    Hash32 digest;
+#ifdef HAVE_OPENSSL
+    if (backend == Sha256Backend::OpenSsl) {
+        if (EVP_Digest(data.data(), data.size(), digest.data(), nullptr, EVP_sha256(),
+                       nullptr) != 1) {
+            return Result<Hash32>::Err(Error(ErrorCode::HashError, "EVP_Digest failed"));
+        }
+        return Result<Hash32>::Ok(digest);
+    }
+#endif
+    if (backend == Sha256Backend::Avx2) {
+        detail::sha256_many_avx2(&data, &digest, 1);
+        return Result<Hash32>::Ok(digest);
+    }
+    
+    Sha256 hasher(backend);
+    hasher.update(data);
+    digest = hasher.final();
+    return Result<Hash32>::Ok(digest);
+}
+
+Sha256Backend sha256_many_backend() {
+    static const Sha256Backend backend = select_many_backend();
+    return backend;
+}
+
+Result<void> sha256_many(Span<const ByteSpan> inputs, Span<Hash32> outputs) {
+    return sha256_many(inputs, outputs, sha256_many_backend());
+}
 
+Result<void> sha256_many(Span<const ByteSpan> inputs, Span<Hash32> outputs,
+                         Sha256Backend backend) {
+    if (inputs.size() != outputs.size()) {
+        return Result<void>::Err(Error(ErrorCode::HashError,
+            "sha256_many: " + std::to_string(inputs.size()) + " inputs but " +
+            std::to_string(outputs.size()) + " outputs"));
+    }
+    if (!sha256_backend_available(backend)) {
+        return Result<void>::Err(Error(ErrorCode::HashError,
+            std::string("SHA-256 backend not available: ") + sha256_backend_name(backend)));
+    }
+    
+    if (backend == Sha256Backend::Avx2) {
+        detail::sha256_many_avx2(inputs.data(), outputs.data(), inputs.size());
+        return Result<void>::Ok();
+    }
+    
+    for (size_t i = 0; i < inputs.size(); ++i) {
+        auto digest_result = sha256(inputs[i], backend);
+        if (digest_result.is_err()) {
+            return Result<void>::Err(digest_result.error());
+        }
+        outputs[i] = digest_result.value();
+    }
+    return Result<void>::Ok();
+}
+
+Result<Hash32> sha256(ByteSpan data) {
+    return sha256(data, sha256_backend());
+}
+
+Result<Hash32> sha256_concat(const std::vector<std::vector<uint8_t>>& parts) {
+    // Hash the parts in sequence; no concatenation buffer needed
+    Sha256 hasher;
+    for (const auto& part : parts) {
+        hasher.update(part.data(), part.size());
+    }
+    return Result<Hash32>::Ok(hasher.final());
+}
+
+Result<Hash32> create_signing_message(uint32_t chain_id, ByteSpan tx_data) {
+    // Format: SHA256("TXv1" || chain_id_be || canonical_encode(tx_without_sigs))
+    Sha256 hasher = begin_signing_message(chain_id);
+    hasher.update(tx_data);
+    return Result<Hash32>::Ok(hasher.final());
+}
+
+} // namespace pqc_ledger::crypto
@@ -1,5 +1,6 @@
 #include "pqc_ledger/crypto/pq.hpp"
 #include <oqs/oqs.h>
+#include <array>
 #include <fstream>
 #include <stdexcept>
 #include <cstring>
@@ -7,98 +8,208 @@
 namespace pqc_ledger::crypto {
 
 namespace {
-    // Map algorithm name to liboqs algorithm string
-    // Note: Modern liboqs uses ML-DSA (NIST standard) instead of Dilithium
-    // ML-DSA-65 is roughly equivalent to Dilithium3
-    const char* get_oqs_alg_name(const std::string& algorithm) {
-        if (algorithm == "Dilithium3" || algorithm == "Dilithium-3" || algorithm == "ML-DSA-65") {
-            // Use ML-DSA-65 (NIST standard, equivalent to Dilithium3)
-            return "ML-DSA-65";
-        } else if (algorithm == "Dilithium2" || algorithm == "Dilithium-2" || algorithm == "ML-DSA-44") {
-            // Use ML-DSA-44 (NIST standard, equivalent to Dilithium2)
-            return "ML-DSA-44";
-        } else if (algorithm == "Dilithium5" || algorithm == "Dilithium-5" || algorithm == "ML-DSA-87") {
-            // Use ML-DSA-87 (NIST standard, equivalent to Dilithium5)
-            return "ML-DSA-87";
+    constexpr size_t kAlgorithmCount = PQ_PARAMS.size();
+    
+    size_t algorithm_index(PqAlgorithm algorithm) {
+        return static_cast<size_t>(algorithm);
+    }
+    
+    // liboqs method names to try for each algorithm, in order of preference.
+    // Note: Modern liboqs uses ML-DSA (NIST standard) instead of Dilithium;
+    // the old Dilithium names are kept for compatibility with older builds.
+    const char* const* oqs_candidates(PqAlgorithm algorithm) {
+        static const char* const ml_dsa_44[] = {"ML-DSA-44", "Dilithium2", "Dilithium-2", nullptr};
+        static const char* const ml_dsa_65[] = {"ML-DSA-65", "Dilithium3", "Dilithium-3", nullptr};
+        static const char* const ml_dsa_87[] = {"ML-DSA-87", "Dilithium5", "Dilithium-5", nullptr};
+        switch (algorithm) {
+        case PqAlgorithm::MlDsa44:
+            return ml_dsa_44;
+        case PqAlgorithm::MlDsa65:
+            return ml_dsa_65;
+        case PqAlgorithm::MlDsa87:
+            return ml_dsa_87;
         }
         return nullptr;
     }
     
-    // Try to find an available ML-DSA algorithm (NIST standard)
-    const char* find_available_ml_dsa() {
-        // Ensure OQS is initialized
-        static bool oqs_initialized = false;
-        if (!oqs_initialized) {
+    // Process-wide algorithm registry.
+    // Built exactly once on first use (function-local static initialization is
+    // thread-safe), after which it is immutable and safe to read from any thread.
+    class AlgorithmRegistry {
+    public:
+        static const AlgorithmRegistry& instance() {
+            static const AlgorithmRegistry registry;
+            return registry;
+        }
+        
+        // Returns nullptr if no ML-DSA algorithm is available at all
+        const PqAlgorithmDescriptor* find(PqAlgorithm algorithm) const {
+            size_t index = algorithm_index(algorithm);
+            if (index >= kAlgorithmCount || descriptors_[index].context == nullptr) {
+                return nullptr;
+            }
+            return &descriptors_[index];
+        }
+        
+        // Returns the liboqs sizes that disagreed with the table, or nullptr
+        const PqAlgorithmDescriptor* mismatch(PqAlgorithm algorithm) const {
+            size_t index = algorithm_index(algorithm);
+            if (index >= kAlgorithmCount || mismatches_[index].oqs_name == nullptr) {
+                return nullptr;
+            }
+            return &mismatches_[index];
+        }
+        
+        AlgorithmRegistry(const AlgorithmRegistry&) = delete;
+        AlgorithmRegistry& operator=(const AlgorithmRegistry&) = delete;
+        
+    private:
+        AlgorithmRegistry() {
             OQS_init();
-            oqs_initialized = true;
+            
+            // Create one context per algorithm
+            for (size_t i = 0; i < kAlgorithmCount; ++i) {
+                auto algorithm = static_cast<PqAlgorithm>(i);
+                for (const char* const* name = oqs_candidates(algorithm); *name != nullptr; ++name) {
+                    OQS_SIG* sig = OQS_SIG_new(*name);
+                    if (sig == nullptr) {
+                        continue;
+                    }
+                    // The wire format is pinned to the compile-time sizes; a context
+                    // that disagrees (e.g. pre-standard Dilithium) cannot be used
+                    if (!matches_params(sig, pq_params(algorithm))) {
+                        if (mismatches_[i].oqs_name == nullptr) {
+                            mismatches_[i] = make_descriptor(algorithm, sig, false);
+                            mismatches_[i].oqs_name = *name;  // sig is freed below
+                            mismatches_[i].context = nullptr;
+                        }
+                        OQS_SIG_free(sig);
+                        continue;
+                    }
+                    contexts_[i] = sig;
+                    descriptors_[i] = make_descriptor(algorithm, sig, false);
+                    break;
+                }
+            }
+            
+            // Algorithms not enabled in this liboqs build fall back to the first
+            // available ML-DSA level (ML-DSA-65 preferred)
+            const OQS_SIG* fallback = nullptr;
+            for (auto preferred : {PqAlgorithm::MlDsa65, PqAlgorithm::MlDsa44, PqAlgorithm::MlDsa87}) {
+                if (contexts_[algorithm_index(preferred)] != nullptr) {
+                    fallback = contexts_[algorithm_index(preferred)];
+                    break;
+                }
+            }
+            for (size_t i = 0; i < kAlgorithmCount; ++i) {
+                if (contexts_[i] == nullptr && fallback != nullptr) {
+                    descriptors_[i] = make_descriptor(static_cast<PqAlgorithm>(i), fallback, true);
+                }
+            }
         }
         
-        // Try ML-DSA algorithms (NIST standard names)
-        const char* algorithms[] = {"ML-DSA-65", "ML-DSA-44", "ML-DSA-87", 
-                                    // Also try old Dilithium names for compatibility
-                                    "Dilithium3", "Dilithium-3", "Dilithium2", "Dilithium-2", 
-                                    "Dilithium5", "Dilithium-5", nullptr};
-        for (int i = 0; algorithms[i] != nullptr; ++i) {
-            OQS_SIG* sig = OQS_SIG_new(algorithms[i]);
-            if (sig != nullptr) {
-                OQS_SIG_free(sig);
-                return algorithms[i];
+        ~AlgorithmRegistry() {
+            for (OQS_SIG* sig : contexts_) {
+                if (sig != nullptr) {
+                    OQS_SIG_free(sig);
+                }
             }
         }
-        return nullptr;
+        
+        static bool matches_params(const OQS_SIG* sig, const PqParams& params) {
+            return sig->length_public_key == params.pubkey_size &&
+                   sig->length_secret_key == params.secret_key_size &&
+                   sig->length_signature == params.signature_size;
+        }
+        
+        static PqAlgorithmDescriptor make_descriptor(PqAlgorithm algorithm, const OQS_SIG* sig,
+                                                     bool is_fallback) {
+            PqAlgorithmDescriptor desc{};
+            desc.algorithm = algorithm;
+            desc.oqs_name = sig->method_name;
+            desc.context = sig;
+            desc.pubkey_size = sig->length_public_key;
+            desc.secret_key_size = sig->length_secret_key;
+            desc.signature_size = sig->length_signature;
+            desc.is_fallback = is_fallback;
+            return desc;
+        }
+        
+        std::array<OQS_SIG*, kAlgorithmCount> contexts_{};
+        std::array<PqAlgorithmDescriptor, kAlgorithmCount> descriptors_{};
+        std::array<PqAlgorithmDescriptor, kAlgorithmCount> mismatches_{};
+    };
+}
+
+Result<PqAlgorithm> parse_algorithm(const std::string& algorithm) {
+    if (algorithm == "Dilithium3" || algorithm == "Dilithium-3" || algorithm == "ML-DSA-65") {
+        return Result<PqAlgorithm>::Ok(PqAlgorithm::MlDsa65);
+    } else if (algorithm == "Dilithium2" || algorithm == "Dilithium-2" || algorithm == "ML-DSA-44") {
+        return Result<PqAlgorithm>::Ok(PqAlgorithm::MlDsa44);
+    } else if (algorithm == "Dilithium5" || algorithm == "Dilithium-5" || algorithm == "ML-DSA-87") {
+        return Result<PqAlgorithm>::Ok(PqAlgorithm::MlDsa87);
     }
+    return Result<PqAlgorithm>::Err(Error(ErrorCode::UnknownError, "Unknown algorithm: " + algorithm));
 }
 
-Result<std::pair<PublicKey, std::vector<uint8_t>>> generate_keypair(const std::string& algorithm) {
-    // Initialize OQS if not already initialized
-    static bool oqs_initialized = false;
-    if (!oqs_initialized) {
-        OQS_init();
-        oqs_initialized = true;
+Result<const PqAlgorithmDescriptor*> get_algorithm(PqAlgorithm algorithm) {
+    const PqAlgorithmDescriptor* desc = AlgorithmRegistry::instance().find(algorithm);
+    if (desc == nullptr) {
+        return Result<const PqAlgorithmDescriptor*>::Err(
+            Error(ErrorCode::UnknownError,
+                  "No ML-DSA algorithm available. "
+                  "Please ensure liboqs is built with ML-DSA (or Dilithium) algorithms enabled."));
     }
-    
-    const char* alg_name = get_oqs_alg_name(algorithm);
-    if (!alg_name) {
+    return Result<const PqAlgorithmDescriptor*>::Ok(desc);
+}
+
+Result<void> check_pq_params() {
+    const auto& registry = AlgorithmRegistry::instance();
+    for (const auto& params : PQ_PARAMS) {
+        const PqAlgorithmDescriptor* found = registry.mismatch(params.algorithm);
+        if (found == nullptr) {
+            continue;
+        }
+        return Result<void>::Err(Error(ErrorCode::UnknownError,
+            std::string("liboqs ") + found->oqs_name + " sizes (pubkey " +
+            std::to_string(found->pubkey_size) + ", secret key " +
+            std::to_string(found->secret_key_size) + ", signature " +
+            std::to_string(found->signature_size) + ") do not match " + params.name +
+            " (pubkey " + std::to_string(params.pubkey_size) + ", secret key " +
+            std::to_string(params.secret_key_size) + ", signature " +
+            std::to_string(params.signature_size) + ")"));
+    }
+    return Result<void>::Ok();
+}
+
+Result<std::pair<PublicKey, std::vector<uint8_t>>> generate_keypair(const std::string& algorithm) {
+    auto alg_result = parse_algorithm(algorithm);
+    if (alg_result.is_err()) {
         return Result<std::pair<PublicKey, std::vector<uint8_t>>>::Err(
             Error(ErrorCode::KeyGenerationFailed, "Unknown algorithm: " + algorithm));
     }
-    
-    OQS_SIG* sig = OQS_SIG_new(alg_name);
-    if (sig == nullptr) {
-        // Try to find any available ML-DSA algorithm as fallback
-        if (algorithm == "Dilithium3" || algorithm == "Dilithium2" || algorithm == "Dilithium5" ||
-            algorithm == "ML-DSA-65" || algorithm == "ML-DSA-44" || algorithm == "ML-DSA-87") {
-            const char* fallback = find_available_ml_dsa();
-            if (fallback) {
-                sig = OQS_SIG_new(fallback);
-                if (sig != nullptr) {
-                    // Use the fallback algorithm
-                    alg_name = fallback;
-                }
-            }
-        }
-        
-        if (sig == nullptr) {
-            return Result<std::pair<PublicKey, std::vector<uint8_t>>>::Err(
-                Error(ErrorCode::KeyGenerationFailed, 
-                      "Algorithm " + algorithm + " not enabled at compile-time or not available. "
-                      "Please ensure liboqs is built with ML-DSA (or Dilithium) algorithms enabled."));
-        }
+    return generate_keypair(alg_result.value());
+}
+
+Result<std::pair<PublicKey, std::vector<uint8_t>>> generate_keypair(PqAlgorithm algorithm) {
+    const PqAlgorithmDescriptor* desc = AlgorithmRegistry::instance().find(algorithm);
+    if (desc == nullptr) {
+        return Result<std::pair<PublicKey, std::vector<uint8_t>>>::Err(
+            Error(ErrorCode::KeyGenerationFailed, 
+                  "Algorithm not enabled at compile-time or not available. "
+                  "Please ensure liboqs is built with ML-DSA (or Dilithium) algorithms enabled."));
     }
     
-    PublicKey pubkey(sig->length_public_key);
-    std::vector<uint8_t> privkey(sig->length_secret_key);
+    PublicKey pubkey(desc->pubkey_size);
+    std::vector<uint8_t> privkey(desc->secret_key_size);
     
-    OQS_STATUS status = OQS_SIG_keypair(sig, pubkey.data(), privkey.data());
+    OQS_STATUS status = OQS_SIG_keypair(desc->context, pubkey.data(), privkey.data());
     
     if (status != OQS_SUCCESS) {
-        OQS_SIG_free(sig);
         return Result<std::pair<PublicKey, std::vector<uint8_t>>>::Err(
             Error(ErrorCode::KeyGenerationFailed, "Key generation failed with status: " + std::to_string(status)));
     }
     
-    OQS_SIG_free(sig);
-    
     return Result<std::pair<PublicKey, std::vector<uint8_t>>>::Ok({std::move(pubkey), std::move(privkey)});
 }
 
@@ -152,61 +263,42 @@ Result<void> save_private_key(const std::vector<uint8_t>& privkey, const std::st
     return Result<void>::Ok();
 }
 
-Result<Signature> sign(const std::vector<uint8_t>& message,
+Result<Signature> sign(ByteSpan message,
                        const std::vector<uint8_t>& privkey,
                        const std::string& algorithm) {
-    // Initialize OQS if not already initialized
-    static bool oqs_initialized = false;
-    if (!oqs_initialized) {
-        OQS_init();
-        oqs_initialized = true;
-    }
-    
-    const char* alg_name = get_oqs_alg_name(algorithm);
-    if (!alg_name) {
+    auto alg_result = parse_algorithm(algorithm);
+    if (alg_result.is_err()) {
         return Result<Signature>::Err(
             Error(ErrorCode::SignatureVerificationFailed, "Unknown algorithm: " + algorithm));
     }
-    
-    OQS_SIG* sig = OQS_SIG_new(alg_name);
-    if (sig == nullptr) {
-        // Try to find any available ML-DSA algorithm as fallback
-        if (algorithm == "Dilithium3" || algorithm == "Dilithium2" || algorithm == "Dilithium5" ||
-            algorithm == "ML-DSA-65" || algorithm == "ML-DSA-44" || algorithm == "ML-DSA-87") {
-            const char* fallback = find_available_ml_dsa();
-            if (fallback) {
-                sig = OQS_SIG_new(fallback);
-                if (sig != nullptr) {
-                    // Use the fallback algorithm
-                    alg_name = fallback;
-                }
-            }
-        }
-        
-        if (sig == nullptr) {
-            return Result<Signature>::Err(
-                Error(ErrorCode::SignatureVerificationFailed,
-                      "Algorithm " + algorithm + " not enabled at compile-time or not available"));
-        }
+    return sign(message, privkey, alg_result.value());
+}
+
+Result<Signature> sign(ByteSpan message,
+                       const std::vector<uint8_t>& privkey,
+                       PqAlgorithm algorithm) {
+    const PqAlgorithmDescriptor* desc = AlgorithmRegistry::instance().find(algorithm);
+    if (desc == nullptr) {
+        return Result<Signature>::Err(
+            Error(ErrorCode::SignatureVerificationFailed,
+                  "Algorithm not enabled at compile-time or not available"));
     }
     
     // Verify private key size matches expected
-    if (privkey.size() != sig->length_secret_key) {
-        OQS_SIG_free(sig);
+    if (privkey.size() != desc->secret_key_size) {
         return Result<Signature>::Err(
             Error(ErrorCode::InvalidPublicKey,
-                  "Private key size mismatch: expected " + std::to_string(sig->length_secret_key) +
+                  "Private key size mismatch: expected " + std::to_string(desc->secret_key_size) +
                   ", got " + std::to_string(privkey.size())));
     }
     
-    Signature signature(sig->length_signature);
+    Signature signature(desc->signature_size);
     size_t signature_len = 0;
     
-    OQS_STATUS status = OQS_SIG_sign(sig, signature.data(), &signature_len,
+    OQS_STATUS status = OQS_SIG_sign(desc->context, signature.data(), &signature_len,
                                      message.data(), message.size(), privkey.data());
     
     if (status != OQS_SUCCESS) {
-        OQS_SIG_free(sig);
         return Result<Signature>::Err(
             Error(ErrorCode::SignatureVerificationFailed,
                   "Signing failed with status: " + std::to_string(status)));
@@ -215,66 +307,45 @@ Result<Signature> sign(const std::vector<uint8_t>& message,
     // Resize signature to actual length (though it should match expected)
     signature.resize(signature_len);
     
-    OQS_SIG_free(sig);
-    
     return Result<Signature>::Ok(std::move(signature));
 }
 
-Result<bool> verify(const std::vector<uint8_t>& message,
-                    const Signature& signature,
-                    const PublicKey& pubkey,
+Result<bool> verify(ByteSpan message,
+                    ByteSpan signature,
+                    ByteSpan pubkey,
                     const std::string& algorithm) {
-    // Initialize OQS if not already initialized
-    static bool oqs_initialized = false;
-    if (!oqs_initialized) {
-        OQS_init();
-        oqs_initialized = true;
-    }
-    
-    const char* alg_name = get_oqs_alg_name(algorithm);
-    if (!alg_name) {
+    auto alg_result = parse_algorithm(algorithm);
+    if (alg_result.is_err()) {
         return Result<bool>::Err(
             Error(ErrorCode::SignatureVerificationFailed, "Unknown algorithm: " + algorithm));
     }
-    
-    OQS_SIG* sig = OQS_SIG_new(alg_name);
-    if (sig == nullptr) {
-        // Try to find any available ML-DSA algorithm as fallback
-        if (algorithm == "Dilithium3" || algorithm == "Dilithium2" || algorithm == "Dilithium5" ||
-            algorithm == "ML-DSA-65" || algorithm == "ML-DSA-44" || algorithm == "ML-DSA-87") {
-            const char* fallback = find_available_ml_dsa();
-            if (fallback) {
-                sig = OQS_SIG_new(fallback);
-                if (sig != nullptr) {
-                    // Use the fallback algorithm
-                    alg_name = fallback;
-                }
-            }
-        }
-        
-        if (sig == nullptr) {
-            return Result<bool>::Err(
-                Error(ErrorCode::SignatureVerificationFailed,
-                      "Algorithm " + algorithm + " not enabled at compile-time or not available"));
-        }
+    return verify(message, signature, pubkey, alg_result.value());
+}
+
+Result<bool> verify(ByteSpan message,
+                    ByteSpan signature,
+                    ByteSpan pubkey,
+                    PqAlgorithm algorithm) {
+    // Hot path: registry lookup is an array index, no allocation or string compare
+    const PqAlgorithmDescriptor* desc = AlgorithmRegistry::instance().find(algorithm);
+    if (desc == nullptr) {
+        return Result<bool>::Err(
+            Error(ErrorCode::SignatureVerificationFailed,
+                  "Algorithm not enabled at compile-time or not available"));
     }
     
     // Verify key sizes match expected
-    if (pubkey.size() != sig->length_public_key) {
-        OQS_SIG_free(sig);
+    if (pubkey.size() != desc->pubkey_size) {
         return Result<bool>::Ok(false);  // Invalid key size, verification fails
     }
     
-    if (signature.size() != sig->length_signature) {
-        OQS_SIG_free(sig);
+    if (signature.size() != desc->signature_size) {
         return Result<bool>::Ok(false);  // Invalid signature size, verification fails
     }
     
-    OQS_STATUS status = OQS_SIG_verify(sig, message.data(), message.size(),
+    OQS_STATUS status = OQS_SIG_verify(desc->context, message.data(), message.size(),
                                        signature.data(), signature.size(), pubkey.data());
     
-    OQS_SIG_free(sig);
-    
     if (status == OQS_SUCCESS) {
         return Result<bool>::Ok(true);
     } else {
@@ -283,54 +354,35 @@ Result<bool> verify(const std::vector<uint8_t>& message,
 }
 
 Result<size_t> get_pubkey_size(const std::string& algorithm) {
-    // Ensure OQS is initialized
-    static bool oqs_initialized = false;
-    if (!oqs_initialized) {
-        OQS_init();
-        oqs_initialized = true;
-    }
-    
-    const char* alg_name = get_oqs_alg_name(algorithm);
-    if (!alg_name) {
+    auto alg_result = parse_algorithm(algorithm);
+    if (alg_result.is_err()) {
         return Result<size_t>::Err(Error(ErrorCode::InvalidPublicKey, "Unknown algorithm: " + algorithm));
     }
-    
-    OQS_SIG* sig = OQS_SIG_new(alg_name);
-    if (sig == nullptr) {
-        return Result<size_t>::Err(Error(ErrorCode::InvalidPublicKey,
-                                         "Algorithm " + algorithm + " not available"));
+    return get_pubkey_size(alg_result.value());
+}
+
+Result<size_t> get_pubkey_size(PqAlgorithm algorithm) {
+    const PqAlgorithmDescriptor* desc = AlgorithmRegistry::instance().find(algorithm);
+    if (desc == nullptr || desc->is_fallback) {
+        return Result<size_t>::Err(Error(ErrorCode::InvalidPublicKey, "Algorithm not available"));
     }
-    
-    size_t pubkey_size = sig->length_public_key;
-    OQS_SIG_free(sig);
-    
-    return Result<size_t>::Ok(pubkey_size);
+    return Result<size_t>::Ok(desc->pubkey_size);
 }
 
 Result<size_t> get_signature_size(const std::string& algorithm) {
-    // Ensure OQS is initialized
-    static bool oqs_initialized = false;
-    if (!oqs_initialized) {
-        OQS_init();
-        oqs_initialized = true;
-    }
-    
-    const char* alg_name = get_oqs_alg_name(algorithm);
-    if (!alg_name) {
+    auto alg_result = parse_algorithm(algorithm);
+    if (alg_result.is_err()) {
         return Result<size_t>::Err(Error(ErrorCode::InvalidSignature, "Unknown algorithm: " + algorithm));
     }
-    
-    OQS_SIG* sig = OQS_SIG_new(alg_name);
-    if (sig == nullptr) {
-        return Result<size_t>::Err(Error(ErrorCode::InvalidSignature,
-                                         "Algorithm " + algorithm + " not available"));
+    return get_signature_size(alg_result.value());
+}
+
+Result<size_t> get_signature_size(PqAlgorithm algorithm) {
+    const PqAlgorithmDescriptor* desc = AlgorithmRegistry::instance().find(algorithm);
+    if (desc == nullptr || desc->is_fallback) {
+        return Result<size_t>::Err(Error(ErrorCode::InvalidSignature, "Algorithm not available"));
     }
-    
-    size_t sig_size = sig->length_signature;
-    OQS_SIG_free(sig);
-    
-    return Result<size_t>::Ok(sig_size);
+    return Result<size_t>::Ok(desc->signature_size);
 }
 
 } // namespace pqc_ledger::crypto
-
@@ -0,0 +1,235 @@
+#include "crypto/sha256_backend.hpp"
+#include "util/cpu_features.hpp"
+#include <algorithm>
+#include <cstring>
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#define PQC_LEDGER_AVX2 1
+#include <immintrin.h>
+#endif
+
+// Enabled per function, like the SHA-NI path; callers check cpuid first
+#if defined(PQC_LEDGER_AVX2) && (defined(__GNUC__) || defined(__clang__))
+#define PQC_LEDGER_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define PQC_LEDGER_TARGET_AVX2
+#endif
+
+namespace pqc_ledger::crypto::detail {
+
+#ifdef PQC_LEDGER_AVX2
+
+namespace {
+    constexpr size_t kLanes = 8;
+    
+    const uint32_t kInitialState[8] = {0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
+                                       0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19};
+    
+    // One message mapped onto a lane: whole blocks are read in place, the final
+    // partial block and the padding come from tail
+    struct LaneInput {
+        const uint8_t* data;
+        size_t full_blocks;
+        size_t total_blocks;
+        uint8_t tail[128];
+    };
+    
+    void prepare_lane(LaneInput& lane, const uint8_t* data, size_t size) {
+        lane.data = data;
+        lane.full_blocks = size / 64;
+        size_t rem = size % 64;
+        size_t tail_blocks = (rem + 9 > 64) ? 2 : 1;
+        lane.total_blocks = lane.full_blocks + tail_blocks;
+        
+        std::memset(lane.tail, 0, sizeof(lane.tail));
+        if (rem > 0) {
+            std::memcpy(lane.tail, data + lane.full_blocks * 64, rem);
+        }
+        lane.tail[rem] = 0x80;
+        uint64_t bit_len = static_cast<uint64_t>(size) * 8;
+        for (size_t i = 0; i < 8; ++i) {
+            lane.tail[tail_blocks * 64 - 1 - i] = static_cast<uint8_t>(bit_len >> (8 * i));
+        }
+    }
+    
+    const uint8_t* block_ptr(const LaneInput& lane, size_t block) {
+        if (block < lane.full_blocks) {
+            return lane.data + block * 64;
+        }
+        if (block < lane.total_blocks) {
+            return lane.tail + (block - lane.full_blocks) * 64;
+        }
+        return lane.tail;  // Lane already finished; its state is no longer read
+    }
+    
+    template<int N>
+    PQC_LEDGER_TARGET_AVX2 inline __m256i rotr(__m256i x) {
+        return _mm256_or_si256(_mm256_srli_epi32(x, N), _mm256_slli_epi32(x, 32 - N));
+    }
+    
+    PQC_LEDGER_TARGET_AVX2 inline __m256i add(__m256i a, __m256i b) {
+        return _mm256_add_epi32(a, b);
+    }
+    
+    PQC_LEDGER_TARGET_AVX2 inline __m256i bxor(__m256i a, __m256i b, __m256i c) {
+        return _mm256_xor_si256(_mm256_xor_si256(a, b), c);
+    }
+    
+    // out[j] = big-endian word (offset / 4 + j) of every lane's block
+    PQC_LEDGER_TARGET_AVX2
+    void load_words(const uint8_t* const blocks[kLanes], size_t offset, __m256i out[8]) {
+        __m256i r[8];
+        for (size_t l = 0; l < kLanes; ++l) {
+            r[l] = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(blocks[l] + offset));
+        }
+        
+        // 8x8 transpose of 32-bit elements
+        __m256i t0 = _mm256_unpacklo_epi32(r[0], r[1]);
+        __m256i t1 = _mm256_unpackhi_epi32(r[0], r[1]);
+        __m256i t2 = _mm256_unpacklo_epi32(r[2], r[3]);
+        __m256i t3 = _mm256_unpackhi_epi32(r[2], r[3]);
+        __m256i t4 = _mm256_unpacklo_epi32(r[4], r[5]);
+        __m256i t5 = _mm256_unpackhi_epi32(r[4], r[5]);
+        __m256i t6 = _mm256_unpacklo_epi32(r[6], r[7]);
+        __m256i t7 = _mm256_unpackhi_epi32(r[6], r[7]);
+        
+        __m256i u0 = _mm256_unpacklo_epi64(t0, t2);
+        __m256i u1 = _mm256_unpackhi_epi64(t0, t2);
+        __m256i u2 = _mm256_unpacklo_epi64(t1, t3);
+        __m256i u3 = _mm256_unpackhi_epi64(t1, t3);
+        __m256i u4 = _mm256_unpacklo_epi64(t4, t6);
+        __m256i u5 = _mm256_unpackhi_epi64(t4, t6);
+        __m256i u6 = _mm256_unpacklo_epi64(t5, t7);
+        __m256i u7 = _mm256_unpackhi_epi64(t5, t7);
+        
+        out[0] = _mm256_permute2x128_si256(u0, u4, 0x20);
+        out[1] = _mm256_permute2x128_si256(u1, u5, 0x20);
+        out[2] = _mm256_permute2x128_si256(u2, u6, 0x20);
+        out[3] = _mm256_permute2x128_si256(u3, u7, 0x20);
+        out[4] = _mm256_permute2x128_si256(u0, u4, 0x31);
+        out[5] = _mm256_permute2x128_si256(u1, u5, 0x31);
+        out[6] = _mm256_permute2x128_si256(u2, u6, 0x31);
+        out[7] = _mm256_permute2x128_si256(u3, u7, 0x31);
+        
+        const __m256i byteswap = _mm256_set_epi8(
+            12, 13, 14, 15, 8, 9, 10, 11, 4, 5, 6, 7, 0, 1, 2, 3,
+            12, 13, 14, 15, 8, 9, 10, 11, 4, 5, 6, 7, 0, 1, 2, 3);
+        for (size_t j = 0; j < 8; ++j) {
+            out[j] = _mm256_shuffle_epi8(out[j], byteswap);
+        }
+    }
+    
+    // One compression per lane; state[i] holds word i of every lane
+    PQC_LEDGER_TARGET_AVX2
+    void compress_x8(__m256i state[8], const uint8_t* const blocks[kLanes]) {
+        __m256i w[16];
+        load_words(blocks, 0, w);
+        load_words(blocks, 32, w + 8);
+        
+        __m256i a = state[0], b = state[1], c = state[2], d = state[3];
+        __m256i e = state[4], f = state[5], g = state[6], h = state[7];
+        for (size_t t = 0; t < 64; ++t) {
+            if (t >= 16) {
+                __m256i w15 = w[(t + 1) & 15];
+                __m256i w2 = w[(t + 14) & 15];
+                __m256i s0 = bxor(rotr<7>(w15), rotr<18>(w15), _mm256_srli_epi32(w15, 3));
+                __m256i s1 = bxor(rotr<17>(w2), rotr<19>(w2), _mm256_srli_epi32(w2, 10));
+                w[t & 15] = add(add(w[t & 15], s0), add(w[(t + 9) & 15], s1));
+            }
+            
+            __m256i s1 = bxor(rotr<6>(e), rotr<11>(e), rotr<25>(e));
+            __m256i ch = _mm256_xor_si256(_mm256_and_si256(e, f), _mm256_andnot_si256(e, g));
+            __m256i k = _mm256_set1_epi32(static_cast<int>(kSha256RoundConstants[t]));
+            __m256i t1 = add(add(add(h, s1), add(ch, k)), w[t & 15]);
+            __m256i s0 = bxor(rotr<2>(a), rotr<13>(a), rotr<22>(a));
+            __m256i maj = _mm256_or_si256(_mm256_and_si256(_mm256_or_si256(a, b), c),
+                                          _mm256_and_si256(a, b));
+            __m256i t2 = add(s0, maj);
+            h = g;
+            g = f;
+            f = e;
+            e = add(d, t1);
+            d = c;
+            c = b;
+            b = a;
+            a = add(t1, t2);
+        }
+        
+        state[0] = add(state[0], a);
+        state[1] = add(state[1], b);
+        state[2] = add(state[2], c);
+        state[3] = add(state[3], d);
+        state[4] = add(state[4], e);
+        state[5] = add(state[5], f);
+        state[6] = add(state[6], g);
+        state[7] = add(state[7], h);
+    }
+    
+    PQC_LEDGER_TARGET_AVX2
+    void extract_digest(const __m256i state[8], size_t lane, Hash32& digest) {
+        alignas(32) uint32_t words[8];
+        for (size_t i = 0; i < 8; ++i) {
+            _mm256_store_si256(reinterpret_cast<__m256i*>(words), state[i]);
+            uint32_t word = words[lane];
+            digest[i * 4] = static_cast<uint8_t>(word >> 24);
+            digest[i * 4 + 1] = static_cast<uint8_t>(word >> 16);
+            digest[i * 4 + 2] = static_cast<uint8_t>(word >> 8);
+            digest[i * 4 + 3] = static_cast<uint8_t>(word);
+        }
+    }
+}
+
+PQC_LEDGER_TARGET_AVX2
+void sha256_many_avx2(const ByteSpan* inputs, Hash32* outputs, size_t count) {
+    LaneInput lanes[kLanes];
+    
+    for (size_t base = 0; base < count; base += kLanes) {
+        // A short final group leaves some lanes idle on an empty message
+        size_t used = std::min(kLanes, count - base);
+        size_t max_blocks = 0;
+        for (size_t l = 0; l < kLanes; ++l) {
+            if (l < used) {
+                prepare_lane(lanes[l], inputs[base + l].data(), inputs[base + l].size());
+                max_blocks = std::max(max_blocks, lanes[l].total_blocks);
+            } else {
+                prepare_lane(lanes[l], nullptr, 0);
+            }
+        }
+        
+        __m256i state[8];
+        for (size_t i = 0; i < 8; ++i) {
+            state[i] = _mm256_set1_epi32(static_cast<int>(kInitialState[i]));
+        }
+        
+        // Lanes run in lockstep; equal-length messages keep every lane busy
+        const uint8_t* blocks[kLanes];
+        for (size_t block = 0; block < max_blocks; ++block) {
+            for (size_t l = 0; l < kLanes; ++l) {
+                blocks[l] = block_ptr(lanes[l], block);
+            }
+            compress_x8(state, blocks);
+            for (size_t l = 0; l < used; ++l) {
+                if (block + 1 == lanes[l].total_blocks) {
+                    extract_digest(state, l, outputs[base + l]);
+                }
+            }
+        }
+    }
+}
+
+bool sha256_avx2_supported() {
+    return util::cpu_features().avx2;
+}
+
+#else
+
+// Never called: sha256_avx2_supported() is false on this target
+void sha256_many_avx2(const ByteSpan*, Hash32*, size_t) {}
+
+bool sha256_avx2_supported() {
+    return false;
+}
+
+#endif
+
+} // namespace pqc_ledger::crypto::detail
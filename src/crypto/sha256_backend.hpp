@@ -0,0 +1,30 @@
+#pragma once
+
+#include "pqc_ledger/types.hpp"
+#include <cstddef>
+#include <cstdint>
+
+namespace pqc_ledger::crypto::detail {
+
+// SHA-256 round constants (FIPS 180-4, section 4.2.2)
+extern const uint32_t kSha256RoundConstants[64];
+
+/**
+ * SHA-256 block function: absorbs num_blocks consecutive 64-byte blocks into state.
+ * No padding is applied; callers handle the final block.
+ */
+using Sha256CompressFn = void (*)(uint32_t state[8], const uint8_t* blocks, size_t num_blocks);
+
+// Scalar implementation, always available
+void sha256_compress_portable(uint32_t state[8], const uint8_t* blocks, size_t num_blocks);
+
+// SHA-NI implementation; only call when sha256_shani_supported() is true
+void sha256_compress_shani(uint32_t state[8], const uint8_t* blocks, size_t num_blocks);
+bool sha256_shani_supported();
+
+// Hashes count independent messages, eight at a time in AVX2 lanes; only call when
+// sha256_avx2_supported() is true
+void sha256_many_avx2(const ByteSpan* inputs, Hash32* outputs, size_t count);
+bool sha256_avx2_supported();
+
+} // namespace pqc_ledger::crypto::detail
@@ -0,0 +1,99 @@
+#include "crypto/sha256_backend.hpp"
+#include "util/cpu_features.hpp"
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#define PQC_LEDGER_SHANI 1
+#include <immintrin.h>
+#endif
+
+// Compiled for the baseline ISA; the SHA-NI code path is enabled per function so the
+// library still runs on CPUs without the extensions (callers check cpuid first).
+#if defined(PQC_LEDGER_SHANI) && (defined(__GNUC__) || defined(__clang__))
+#define PQC_LEDGER_TARGET_SHANI __attribute__((target("sha,sse4.1")))
+#else
+#define PQC_LEDGER_TARGET_SHANI
+#endif
+
+namespace pqc_ledger::crypto::detail {
+
+#ifdef PQC_LEDGER_SHANI
+
+namespace {
+    // Four rounds: (a..h) in ABEF/CDGH form, msg = W[t..t+3]
+    PQC_LEDGER_TARGET_SHANI
+    inline void four_rounds(__m128i& abef, __m128i& cdgh, __m128i msg, size_t group) {
+        const __m128i k = _mm_loadu_si128(
+            reinterpret_cast<const __m128i*>(&kSha256RoundConstants[group * 4]));
+        __m128i wk = _mm_add_epi32(msg, k);
+        cdgh = _mm_sha256rnds2_epu32(cdgh, abef, wk);
+        wk = _mm_shuffle_epi32(wk, 0x0E);
+        abef = _mm_sha256rnds2_epu32(abef, cdgh, wk);
+    }
+    
+    // W[t..t+3] from the previous 16 message words
+    PQC_LEDGER_TARGET_SHANI
+    inline __m128i schedule(__m128i w16, __m128i w12, __m128i w8, __m128i w4) {
+        __m128i w = _mm_sha256msg1_epu32(w16, w12);
+        w = _mm_add_epi32(w, _mm_alignr_epi8(w4, w8, 4));
+        return _mm_sha256msg2_epu32(w, w4);
+    }
+}
+
+PQC_LEDGER_TARGET_SHANI
+void sha256_compress_shani(uint32_t state[8], const uint8_t* blocks, size_t num_blocks) {
+    const __m128i byteswap = _mm_set_epi64x(0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL);
+    
+    // Repack a..h into the ABEF / CDGH layout used by sha256rnds2
+    __m128i tmp = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&state[0]));
+    __m128i cdgh = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&state[4]));
+    tmp = _mm_shuffle_epi32(tmp, 0xB1);         // CDAB
+    cdgh = _mm_shuffle_epi32(cdgh, 0x1B);       // EFGH
+    __m128i abef = _mm_alignr_epi8(tmp, cdgh, 8);  // ABEF
+    cdgh = _mm_blend_epi16(cdgh, tmp, 0xF0);    // CDGH
+    
+    for (; num_blocks > 0; --num_blocks, blocks += 64) {
+        const __m128i abef_save = abef;
+        const __m128i cdgh_save = cdgh;
+        
+        __m128i w[4];
+        for (size_t i = 0; i < 4; ++i) {
+            w[i] = _mm_shuffle_epi8(
+                _mm_loadu_si128(reinterpret_cast<const __m128i*>(blocks + 16 * i)), byteswap);
+            four_rounds(abef, cdgh, w[i], i);
+        }
+        for (size_t i = 4; i < 16; ++i) {
+            w[i & 3] = schedule(w[i & 3], w[(i + 1) & 3], w[(i + 2) & 3], w[(i + 3) & 3]);
+            four_rounds(abef, cdgh, w[i & 3], i);
+        }
+        
+        abef = _mm_add_epi32(abef, abef_save);
+        cdgh = _mm_add_epi32(cdgh, cdgh_save);
+    }
+    
+    // Back to a..h
+    tmp = _mm_shuffle_epi32(abef, 0x1B);        // FEBA
+    cdgh = _mm_shuffle_epi32(cdgh, 0xB1);       // DCHG
+    abef = _mm_blend_epi16(tmp, cdgh, 0xF0);    // DCBA
+    cdgh = _mm_alignr_epi8(cdgh, tmp, 8);       // HGFE
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(&state[0]), abef);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(&state[4]), cdgh);
+}
+
+bool sha256_shani_supported() {
+    const auto& cpu = util::cpu_features();
+    return cpu.sha && cpu.sse41 && cpu.ssse3;
+}
+
+#else
+
+void sha256_compress_shani(uint32_t state[8], const uint8_t* blocks, size_t num_blocks) {
+    sha256_compress_portable(state, blocks, num_blocks);
+}
+
+bool sha256_shani_supported() {
+    return false;
+}
+
+#endif
+
+} // namespace pqc_ledger::crypto::detail
@@ -0,0 +1,96 @@
+#include "pqc_ledger/basic_transaction.hpp"
+#include <algorithm>
+#include <string>
+#include <variant>
+
+namespace pqc_ledger {
+
+namespace {
+    // Empty means "not signed yet" and leaves the destination zeroed
+    template<size_t N>
+    bool copy_exact_or_empty(const std::vector<uint8_t>& from, std::array<uint8_t, N>& to) {
+        if (from.empty()) {
+            to.fill(0);
+            return true;
+        }
+        if (from.size() != N) {
+            return false;
+        }
+        std::copy(from.begin(), from.end(), to.begin());
+        return true;
+    }
+
+    Error size_mismatch(ErrorCode code, const char* field, size_t expected, size_t actual) {
+        return Error(code, std::string(field) + " size mismatch: expected " +
+                               std::to_string(expected) + ", got " + std::to_string(actual));
+    }
+}
+
+template<typename Params>
+Result<BasicTransaction<Params>> BasicTransaction<Params>::from_transaction(const Transaction& tx) {
+    BasicTransaction result;
+    result.version = tx.version;
+    result.chain_id = tx.chain_id;
+    result.nonce = tx.nonce;
+    result.to = tx.to;
+    result.amount = tx.amount;
+    result.fee = tx.fee;
+    result.auth_mode = tx.auth_mode;
+
+    if (tx.from_pubkey.size() != Params::pubkey_size) {
+        return Result<BasicTransaction>::Err(size_mismatch(
+            ErrorCode::InvalidPublicKey, "Public key", Params::pubkey_size, tx.from_pubkey.size()));
+    }
+    std::copy(tx.from_pubkey.begin(), tx.from_pubkey.end(), result.from_pubkey.begin());
+
+    const Signature* classical_sig = nullptr;
+    const Signature* pq_sig = nullptr;
+    if (tx.auth_mode == AuthMode::PqOnly && std::holds_alternative<PqSignature>(tx.auth)) {
+        pq_sig = &std::get<PqSignature>(tx.auth).sig;
+    } else if (tx.auth_mode == AuthMode::Hybrid &&
+               std::holds_alternative<HybridSignature>(tx.auth)) {
+        classical_sig = &std::get<HybridSignature>(tx.auth).classical_sig;
+        pq_sig = &std::get<HybridSignature>(tx.auth).pq_sig;
+    } else {
+        return Result<BasicTransaction>::Err(
+            Error(ErrorCode::InvalidAuthTag, "auth_mode does not match the auth payload"));
+    }
+
+    if (classical_sig != nullptr && !copy_exact_or_empty(*classical_sig, result.classical_sig)) {
+        return Result<BasicTransaction>::Err(size_mismatch(
+            ErrorCode::InvalidSignature, "Ed25519 signature", ED25519_SIG_SIZE,
+            classical_sig->size()));
+    }
+    if (!copy_exact_or_empty(*pq_sig, result.pq_sig)) {
+        return Result<BasicTransaction>::Err(size_mismatch(
+            ErrorCode::InvalidSignature, "PQ signature", Params::signature_size, pq_sig->size()));
+    }
+
+    return Result<BasicTransaction>::Ok(result);
+}
+
+template<typename Params>
+Transaction BasicTransaction<Params>::to_transaction() const {
+    Transaction tx;
+    tx.version = version;
+    tx.chain_id = chain_id;
+    tx.nonce = nonce;
+    tx.from_pubkey.assign(from_pubkey.begin(), from_pubkey.end());
+    tx.to = to;
+    tx.amount = amount;
+    tx.fee = fee;
+    tx.auth_mode = auth_mode;
+    if (auth_mode == AuthMode::Hybrid) {
+        tx.auth = HybridSignature{Signature(classical_sig.begin(), classical_sig.end()),
+                                  Signature(pq_sig.begin(), pq_sig.end())};
+    } else {
+        tx.auth = PqSignature{Signature(pq_sig.begin(), pq_sig.end())};
+    }
+    return tx;
+}
+
+template struct BasicTransaction<crypto::MlDsa44>;
+template struct BasicTransaction<crypto::MlDsa65>;
+template struct BasicTransaction<crypto::MlDsa87>;
+
+} // namespace pqc_ledger
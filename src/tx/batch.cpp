@@ -0,0 +1,133 @@
+#include "pqc_ledger/tx/batch.hpp"
+#include "pqc_ledger/tx/signing.hpp"
+#include "pqc_ledger/codec/encode.hpp"
+#include "pqc_ledger/crypto/hash.hpp"
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <system_error>
+#include <thread>
+
+namespace pqc_ledger::tx {
+
+namespace {
+    VerifyOutcome verify_one(const Transaction& tx, const Hash32& message, VerifyCache* cache) {
+        VerifyOutcome outcome;
+        try {
+            auto result = cache != nullptr ? verify_signatures(tx, message, *cache)
+                                           : verify_signatures(tx, message);
+            if (result.is_err()) {
+                outcome.status = VerifyStatus::Error;
+                outcome.error = result.error().code;
+            } else {
+                outcome.status = result.value() ? VerifyStatus::Valid : VerifyStatus::Invalid;
+            }
+        } catch (const std::exception&) {
+            // e.g. auth_mode disagreeing with the auth variant; never let it escape a worker
+            outcome.status = VerifyStatus::Error;
+            outcome.error = ErrorCode::InvalidTransaction;
+        }
+        return outcome;
+    }
+
+    // Signing messages for the whole batch. The signed bytes of every transaction
+    // are packed into one buffer and hashed together with multi-buffer SHA-256.
+    // Transactions that cannot be encoded get an Error outcome and no message.
+    std::vector<Hash32> hash_batch(Span<const Transaction> txs,
+                                   uint32_t chain_id,
+                                   std::vector<VerifyOutcome>& outcomes,
+                                   std::vector<bool>& hashed) {
+        const auto prefix = crypto::signing_message_prefix(chain_id);
+
+        std::vector<uint8_t> arena;
+        arena.reserve(txs.size() * (prefix.size() + PQ_PUBKEY_SIZE + 96));
+        std::vector<size_t> offsets;
+        std::vector<size_t> indices;
+        for (size_t i = 0; i < txs.size(); ++i) {
+            size_t start = arena.size();
+            arena.insert(arena.end(), prefix.begin(), prefix.end());
+            auto append_result = codec::append_for_signing(txs[i], arena);
+            if (append_result.is_err()) {
+                arena.resize(start);
+                outcomes[i].status = VerifyStatus::Error;
+                outcomes[i].error = append_result.error().code;
+                continue;
+            }
+            offsets.push_back(start);
+            indices.push_back(i);
+        }
+        offsets.push_back(arena.size());
+
+        // Spans are taken only once the arena has stopped growing
+        std::vector<ByteSpan> inputs(indices.size());
+        for (size_t k = 0; k < indices.size(); ++k) {
+            inputs[k] = ByteSpan(arena.data() + offsets[k], offsets[k + 1] - offsets[k]);
+        }
+        std::vector<Hash32> digests(indices.size());
+        crypto::sha256_many(inputs, digests);  // Sizes match by construction
+
+        std::vector<Hash32> messages(txs.size());
+        for (size_t k = 0; k < indices.size(); ++k) {
+            messages[indices[k]] = digests[k];
+            hashed[indices[k]] = true;
+        }
+        return messages;
+    }
+
+    size_t worker_count(size_t batch_size, const BatchVerifyOptions& options) {
+        size_t threads = options.num_threads;
+        if (threads == 0) {
+            threads = std::max<size_t>(1, std::thread::hardware_concurrency());
+        }
+        size_t per_thread = std::max<size_t>(1, options.min_per_thread);
+        size_t useful = std::max<size_t>(1, batch_size / per_thread);
+        return std::min(threads, useful);
+    }
+}
+
+std::vector<VerifyOutcome> verify_batch(Span<const Transaction> txs,
+                                        uint32_t chain_id,
+                                        const BatchVerifyOptions& options) {
+    std::vector<VerifyOutcome> outcomes(txs.size());
+    if (txs.empty()) {
+        return outcomes;
+    }
+
+    // Hashing is cheap next to ML-DSA, so it is done up front on the calling thread
+    std::vector<bool> hashed(txs.size(), false);
+    const auto messages = hash_batch(txs, chain_id, outcomes, hashed);
+
+    // Workers claim one transaction at a time; an ML-DSA verify is long enough
+    // that the shared counter is never contended in practice.
+    std::atomic<size_t> next{0};
+    auto work = [&]() {
+        for (size_t i = next.fetch_add(1, std::memory_order_relaxed); i < txs.size();
+             i = next.fetch_add(1, std::memory_order_relaxed)) {
+            if (hashed[i]) {
+                outcomes[i] = verify_one(txs[i], messages[i], options.cache);
+            }
+        }
+    };
+
+    // The calling thread is one of the workers
+    size_t workers = worker_count(txs.size(), options);
+    std::vector<std::thread> threads;
+    threads.reserve(workers - 1);
+    for (size_t i = 1; i < workers; ++i) {
+        try {
+            threads.emplace_back(work);
+        } catch (const std::system_error&) {
+            break;  // Could not start another thread; the remaining workers pick up the slack
+        }
+    }
+
+    work();
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    return outcomes;
+}
+
+} // namespace pqc_ledger::tx
@@ -0,0 +1,181 @@
+#include "pqc_ledger/tx/reject_filter.hpp"
+#include "pqc_ledger/crypto/hash.hpp"
+#include "codec/byte_order.hpp"
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <random>
+
+namespace pqc_ledger::tx {
+
+namespace {
+    // SplitMix64 finalizer: spreads salted txid words over all 64 bits
+    uint64_t mix64(uint64_t value) {
+        value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        value = (value ^ (value >> 27)) * 0x94D049BB133111EBULL;
+        return value ^ (value >> 31);
+    }
+
+    size_t round_up_pow2(size_t value) {
+        size_t result = 1;
+        while (result < value) {
+            result <<= 1;
+        }
+        return result;
+    }
+}
+
+RejectFilter::RejectFilter(const RejectFilterOptions& options)
+    : options_(options), current_count_(0), generation_start_(std::chrono::steady_clock::now()) {
+    options_.generation_size = std::max<size_t>(1, options_.generation_size);
+    if (!(options_.false_positive_rate > 0.0 && options_.false_positive_rate < 1.0)) {
+        options_.false_positive_rate = RejectFilterOptions().false_positive_rate;
+    }
+
+    // Optimal bloom size m = -n ln p / (ln 2)^2, rounded up to a power of two
+    // so a bit index is a mask; the hash count k = (m / n) ln 2 is then taken
+    // from the rounded size
+    const double ln2 = std::log(2.0);
+    const double n = static_cast<double>(options_.generation_size);
+    const double bits = std::ceil(-n * std::log(options_.false_positive_rate) / (ln2 * ln2));
+    const size_t num_bits = round_up_pow2(std::max<size_t>(64, static_cast<size_t>(bits)));
+    bit_mask_ = num_bits - 1;
+    const double hashes = std::round(static_cast<double>(num_bits) / n * ln2);
+    num_hashes_ = static_cast<uint32_t>(std::clamp(hashes, 1.0, 16.0));
+    current_.assign(num_bits / 64, 0);
+    previous_.assign(num_bits / 64, 0);
+
+    std::random_device random;
+    for (auto& word : salt_) {
+        word = (static_cast<uint64_t>(random()) << 32) | random();
+    }
+}
+
+RejectFilter::Probe RejectFilter::probe(const Hash32& txid) const noexcept {
+    // Double hashing: bit i is h1 + i * h2; an odd h2 never repeats a bit early
+    Probe result;
+    result.h1 = mix64(codec::detail::load_u64_be(txid.data()) ^ salt_[0]);
+    result.h2 = mix64(codec::detail::load_u64_be(txid.data() + 8) ^ salt_[1]) | 1;
+    return result;
+}
+
+uint64_t RejectFilter::sender_key(ByteSpan sender_pubkey) const noexcept {
+    crypto::Sha256 hasher;
+    hasher.update(reinterpret_cast<const uint8_t*>(salt_.data()), sizeof(salt_));
+    hasher.update(sender_pubkey);
+    const Hash32 digest = hasher.final();
+    return codec::detail::load_u64_be(digest.data());
+}
+
+bool RejectFilter::test(const std::vector<uint64_t>& bits, const Probe& probe) const noexcept {
+    uint64_t position = probe.h1;
+    for (uint32_t i = 0; i < num_hashes_; ++i, position += probe.h2) {
+        const size_t bit = static_cast<size_t>(position) & bit_mask_;
+        if ((bits[bit / 64] & (uint64_t(1) << (bit % 64))) == 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void RejectFilter::rotate_locked() {
+    previous_.swap(current_);
+    std::fill(current_.begin(), current_.end(), 0);
+    current_count_ = 0;
+    generation_start_ = std::chrono::steady_clock::now();
+
+    for (auto it = sender_failures_.begin(); it != sender_failures_.end();) {
+        it->second /= 2;
+        it = it->second == 0 ? sender_failures_.erase(it) : std::next(it);
+    }
+    ++stats_.rotations;
+}
+
+void RejectFilter::rotate_if_due_locked(std::chrono::steady_clock::time_point now) {
+    if (options_.decay_interval.count() > 0 && now - generation_start_ >= options_.decay_interval) {
+        rotate_locked();
+    }
+}
+
+bool RejectFilter::is_rejected(const Hash32& txid, ByteSpan sender_pubkey) {
+    const Probe txid_probe = probe(txid);
+    const bool check_sender = options_.max_sender_failures > 0;
+    const uint64_t sender = check_sender ? sender_key(sender_pubkey) : 0;
+    const auto now = std::chrono::steady_clock::now();
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    rotate_if_due_locked(now);
+    if (test(current_, txid_probe) || test(previous_, txid_probe)) {
+        ++stats_.txid_hits;
+        return true;
+    }
+    if (check_sender) {
+        auto it = sender_failures_.find(sender);
+        if (it != sender_failures_.end() && it->second >= options_.max_sender_failures) {
+            ++stats_.sender_hits;
+            return true;
+        }
+    }
+    return false;
+}
+
+void RejectFilter::record(const Hash32& txid, ByteSpan sender_pubkey) {
+    const Probe txid_probe = probe(txid);
+    const bool count_sender = options_.max_sender_failures > 0;
+    const uint64_t sender = count_sender ? sender_key(sender_pubkey) : 0;
+    const auto now = std::chrono::steady_clock::now();
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    rotate_if_due_locked(now);
+    if (current_count_ >= options_.generation_size) {
+        rotate_locked();
+    }
+    uint64_t position = txid_probe.h1;
+    for (uint32_t i = 0; i < num_hashes_; ++i, position += txid_probe.h2) {
+        const size_t bit = static_cast<size_t>(position) & bit_mask_;
+        current_[bit / 64] |= uint64_t(1) << (bit % 64);
+    }
+    ++current_count_;
+
+    if (count_sender) {
+        uint32_t& failures = sender_failures_[sender];
+        if (failures < UINT32_MAX) {
+            ++failures;
+        }
+    }
+    ++stats_.recorded;
+}
+
+bool RejectFilter::contains(const Hash32& txid) const {
+    const Probe txid_probe = probe(txid);
+    std::lock_guard<std::mutex> lock(mutex_);
+    return test(current_, txid_probe) || test(previous_, txid_probe);
+}
+
+uint32_t RejectFilter::sender_failures(ByteSpan sender_pubkey) const {
+    const uint64_t sender = sender_key(sender_pubkey);
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = sender_failures_.find(sender);
+    return it != sender_failures_.end() ? it->second : 0;
+}
+
+void RejectFilter::rotate() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    rotate_locked();
+}
+
+void RejectFilter::clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::fill(current_.begin(), current_.end(), 0);
+    std::fill(previous_.begin(), previous_.end(), 0);
+    current_count_ = 0;
+    generation_start_ = std::chrono::steady_clock::now();
+    sender_failures_.clear();
+}
+
+RejectFilterStats RejectFilter::stats() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return stats_;
+}
+
+} // namespace pqc_ledger::tx
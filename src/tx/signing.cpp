@@ -1,117 +1,390 @@
 #include "pqc_ledger/tx/signing.hpp"
 #include "pqc_ledger/codec/encode.hpp"
+#include "pqc_ledger/codec/decode.hpp"
 #include "pqc_ledger/crypto/hash.hpp"
 #include "pqc_ledger/crypto/pq.hpp"
 #include "pqc_ledger/crypto/classical.hpp"
+#include <algorithm>
+#include <string>
 
 namespace pqc_ledger::tx {
 
-Result<void> sign_transaction(Transaction& tx,
-                              const std::vector<uint8_t>& privkey,
-                              const std::string& algorithm) {
-    // 1. Encode transaction without signatures
-    auto encoded_result = codec::encode_for_signing(tx);
-    if (encoded_result.is_err()) {
-        return Result<void>::Err(encoded_result.error());
+namespace {
+    // Signing message on top of a hasher primed by crypto::begin_signing_message()
+    Result<Hash32> finish_signing_message(const Transaction& tx,
+                                          const crypto::Sha256& signing_prefix) {
+        crypto::Sha256 hasher = signing_prefix;
+        auto hash_result = codec::hash_for_signing(tx, hasher);
+        if (hash_result.is_err()) {
+            return Result<Hash32>::Err(hash_result.error());
+        }
+        return Result<Hash32>::Ok(hasher.final());
+    }
+}
+
+Result<Hash32> compute_signing_message(const Transaction& tx, uint32_t chain_id) {
+    return finish_signing_message(tx, crypto::begin_signing_message(chain_id));
+}
+
+namespace {
+    // Steps 3-4 of signing: sign the message with the PQ key and attach the signature
+    Result<void> attach_pq_signature(Transaction& tx,
+                                     const Hash32& message,
+                                     const std::vector<uint8_t>& privkey,
+                                     const std::string& algorithm) {
+        auto sig_result = crypto::sign(message, privkey, algorithm);
+        if (sig_result.is_err()) {
+            return Result<void>::Err(sig_result.error());
+        }
+        
+        tx.auth_mode = AuthMode::PqOnly;
+        tx.auth = PqSignature{std::move(sig_result.value())};
+        
+        return Result<void>::Ok();
     }
     
-    // 2. Create domain-separated signing message
-    auto msg_result = crypto::create_signing_message(tx.chain_id, encoded_result.value());
-    if (msg_result.is_err()) {
-        return Result<void>::Err(msg_result.error());
+    // Steps 3-4 of hybrid signing: sign with both keys and attach both signatures
+    Result<void> attach_hybrid_signatures(Transaction& tx,
+                                          const Hash32& message,
+                                          const std::vector<uint8_t>& pq_privkey,
+                                          const std::vector<uint8_t>& ed25519_privkey,
+                                          const std::string& pq_algorithm) {
+        auto pq_sig_result = crypto::sign(message, pq_privkey, pq_algorithm);
+        if (pq_sig_result.is_err()) {
+            return Result<void>::Err(pq_sig_result.error());
+        }
+        
+        auto ed25519_sig_result = crypto::ed25519_sign(message, ed25519_privkey);
+        if (ed25519_sig_result.is_err()) {
+            return Result<void>::Err(ed25519_sig_result.error());
+        }
+        
+        tx.auth_mode = AuthMode::Hybrid;
+        tx.auth = HybridSignature{std::move(ed25519_sig_result.value()),
+                                  std::move(pq_sig_result.value())};
+        
+        return Result<void>::Ok();
     }
     
-    // 3. Sign the message with PQ private key
-    auto sig_result = crypto::sign(msg_result.value(), privkey, algorithm);
-    if (sig_result.is_err()) {
-        return Result<void>::Err(sig_result.error());
+    // Upper bound on the encoded auth fields, so the output is allocated only once
+    size_t auth_capacity(const std::string& pq_algorithm) {
+        auto alg_result = crypto::parse_algorithm(pq_algorithm);
+        size_t pq_sig_size = alg_result.is_ok()
+            ? crypto::pq_params(alg_result.value()).signature_size
+            : PQ_SIG_SIZE;
+        return 1 + 2 + ED25519_SIG_SIZE + 2 + pq_sig_size;
     }
     
-    // 4. Attach signature to transaction
-    tx.auth_mode = AuthMode::PqOnly;
-    tx.auth = PqSignature{std::move(sig_result.value())};
+    // Serialize the unsigned fields once, hash them straight from the output buffer,
+    // sign, then append the auth fields behind them
+    template<typename Attach>
+    Result<std::vector<uint8_t>> sign_and_encode_with(Transaction& tx,
+                                                      size_t auth_size,
+                                                      Attach attach) {
+        std::vector<uint8_t> out;
+        out.reserve(codec::encoded_size(tx) + auth_size);
+        
+        auto append_result = codec::append_for_signing(tx, out);
+        if (append_result.is_err()) {
+            return Result<std::vector<uint8_t>>::Err(append_result.error());
+        }
+        
+        crypto::Sha256 hasher = crypto::begin_signing_message(tx.chain_id);
+        hasher.update(out.data(), out.size());
+        
+        auto attach_result = attach(hasher.final());
+        if (attach_result.is_err()) {
+            return Result<std::vector<uint8_t>>::Err(attach_result.error());
+        }
+        
+        auto auth_result = codec::append_auth(tx, out);
+        if (auth_result.is_err()) {
+            return Result<std::vector<uint8_t>>::Err(auth_result.error());
+        }
+        
+        return Result<std::vector<uint8_t>>::Ok(std::move(out));
+    }
+}
+
+Result<void> sign_transaction(Transaction& tx,
+                              const std::vector<uint8_t>& privkey,
+                              const std::string& algorithm) {
+    // 1-2. Hash the domain prefix and the unsigned fields (streamed, no buffer)
+    auto digest_result = compute_signing_message(tx, tx.chain_id);
+    if (digest_result.is_err()) {
+        return Result<void>::Err(digest_result.error());
+    }
     
-    return Result<void>::Ok();
+    // 3-4. Sign and attach
+    return attach_pq_signature(tx, digest_result.value(), privkey, algorithm);
 }
 
 Result<void> sign_transaction_hybrid(Transaction& tx,
                                      const std::vector<uint8_t>& pq_privkey,
                                      const std::vector<uint8_t>& ed25519_privkey,
                                      const std::string& pq_algorithm) {
-    // 1. Encode transaction without signatures
-    auto encoded_result = codec::encode_for_signing(tx);
-    if (encoded_result.is_err()) {
-        return Result<void>::Err(encoded_result.error());
+    // 1-2. Hash the domain prefix and the unsigned fields (streamed, no buffer)
+    auto digest_result = compute_signing_message(tx, tx.chain_id);
+    if (digest_result.is_err()) {
+        return Result<void>::Err(digest_result.error());
     }
     
-    // 2. Create domain-separated signing message
-    auto msg_result = crypto::create_signing_message(tx.chain_id, encoded_result.value());
-    if (msg_result.is_err()) {
-        return Result<void>::Err(msg_result.error());
+    // 3-4. Sign with both keys and attach
+    return attach_hybrid_signatures(tx, digest_result.value(), pq_privkey, ed25519_privkey,
+                                    pq_algorithm);
+}
+
+Result<std::vector<uint8_t>> sign_and_encode_transaction(Transaction& tx,
+                                                         const std::vector<uint8_t>& privkey,
+                                                         const std::string& algorithm) {
+    return sign_and_encode_with(tx, auth_capacity(algorithm), [&](const Hash32& message) {
+        return attach_pq_signature(tx, message, privkey, algorithm);
+    });
+}
+
+Result<std::vector<uint8_t>> sign_and_encode_transaction_hybrid(
+    Transaction& tx,
+    const std::vector<uint8_t>& pq_privkey,
+    const std::vector<uint8_t>& ed25519_privkey,
+    const std::string& pq_algorithm) {
+    return sign_and_encode_with(tx, auth_capacity(pq_algorithm), [&](const Hash32& message) {
+        return attach_hybrid_signatures(tx, message, pq_privkey, ed25519_privkey, pq_algorithm);
+    });
+}
+
+namespace {
+    // Step 3 of verification, over borrowed bytes so owning transactions and
+    // wire views share it
+    Result<bool> verify_signature_spans(AuthMode auth_mode,
+                                        ByteSpan message,
+                                        ByteSpan pubkey,
+                                        ByteSpan classical_sig,
+                                        ByteSpan pq_sig) {
+        if (auth_mode == AuthMode::PqOnly) {
+            return crypto::verify(message, pq_sig, pubkey, crypto::DefaultPqParams::algorithm);
+            
+        } else if (auth_mode == AuthMode::Hybrid) {
+            // Verify both signatures
+            auto ed25519_result = crypto::ed25519_verify(message, classical_sig, pubkey);
+            if (ed25519_result.is_err()) {
+                return Result<bool>::Err(ed25519_result.error());
+            }
+            if (!ed25519_result.value()) {
+                return Result<bool>::Ok(false);
+            }
+            
+            return crypto::verify(message, pq_sig, pubkey, crypto::DefaultPqParams::algorithm);
+            
+        } else {
+            return Result<bool>::Err(Error(ErrorCode::InvalidAuthTag, "Unknown auth mode"));
+        }
     }
     
-    // 3. Sign with both keys
-    auto pq_sig_result = crypto::sign(msg_result.value(), pq_privkey, pq_algorithm);
-    if (pq_sig_result.is_err()) {
-        return Result<void>::Err(pq_sig_result.error());
+    // verify_signature_spans() behind an optional cache of earlier successes
+    Result<bool> verify_spans_cached(AuthMode auth_mode,
+                                     const Hash32& message,
+                                     ByteSpan pubkey,
+                                     ByteSpan classical_sig,
+                                     ByteSpan pq_sig,
+                                     VerifyCache* cache) {
+        if (cache == nullptr) {
+            return verify_signature_spans(auth_mode, message, pubkey, classical_sig, pq_sig);
+        }
+        const Hash32 key = cache->key(auth_mode, message, pubkey, classical_sig, pq_sig);
+        if (cache->contains(key)) {
+            return Result<bool>::Ok(true);
+        }
+        auto result = verify_signature_spans(auth_mode, message, pubkey, classical_sig, pq_sig);
+        if (result.is_ok() && result.value()) {
+            cache->insert(key);
+        }
+        return result;
     }
     
-    auto ed25519_sig_result = crypto::ed25519_sign(msg_result.value(), ed25519_privkey);
-    if (ed25519_sig_result.is_err()) {
-        return Result<void>::Err(ed25519_sig_result.error());
+    Result<bool> verify_tx_signatures(const Transaction& tx, const Hash32& message,
+                                      VerifyCache* cache) {
+        if (tx.auth_mode == AuthMode::PqOnly) {
+            const auto& pq_sig = std::get<PqSignature>(tx.auth);
+            return verify_spans_cached(tx.auth_mode, message, tx.from_pubkey, ByteSpan(),
+                                       pq_sig.sig, cache);
+        } else if (tx.auth_mode == AuthMode::Hybrid) {
+            const auto& hybrid_sig = std::get<HybridSignature>(tx.auth);
+            return verify_spans_cached(tx.auth_mode, message, tx.from_pubkey,
+                                       hybrid_sig.classical_sig, hybrid_sig.pq_sig, cache);
+        } else {
+            return Result<bool>::Err(Error(ErrorCode::InvalidAuthTag, "Unknown auth mode"));
+        }
     }
     
-    // 4. Attach both signatures to transaction
-    tx.auth_mode = AuthMode::Hybrid;
-    tx.auth = HybridSignature{std::move(ed25519_sig_result.value()), std::move(pq_sig_result.value())};
+    Result<bool> verify_tx(const Transaction& tx, const crypto::Sha256& signing_prefix,
+                           VerifyCache* cache) {
+        // 1-2. Hash the unsigned fields on top of the domain prefix
+        auto digest_result = finish_signing_message(tx, signing_prefix);
+        if (digest_result.is_err()) {
+            return Result<bool>::Err(digest_result.error());
+        }
+        
+        // 3. Verify signature(s)
+        return verify_tx_signatures(tx, digest_result.value(), cache);
+    }
     
-    return Result<void>::Ok();
+    Result<bool> verify_decoded_view(const TransactionView& view,
+                                     const crypto::Sha256& signing_prefix,
+                                     VerifyCache* cache) {
+        if (view.signed_bytes.empty()) {
+            return Result<bool>::Err(Error(ErrorCode::InvalidTransaction,
+                "View carries no signed bytes; it was not decoded from an encoding"));
+        }
+        
+        // Hash the signed-over region of the encoding as-is
+        crypto::Sha256 hasher = signing_prefix;
+        hasher.update(view.signed_bytes);
+        const Hash32 message = hasher.final();
+        
+        return verify_spans_cached(view.auth_mode, message, view.from_pubkey,
+                                   view.classical_sig, view.pq_sig, cache);
+    }
+    
+    Result<bool> verify_wire(ByteSpan wire, const crypto::Sha256& signing_prefix,
+                             VerifyCache* cache) {
+        // 1. Parse in place: the view borrows the signatures and the signed bytes
+        auto view_result = codec::decode_view(wire.data(), wire.size());
+        if (view_result.is_err()) {
+            return Result<bool>::Err(view_result.error());
+        }
+        
+        // 2-3. Hash the signed-over region as-is and verify the signature(s)
+        return verify_decoded_view(view_result.value(), signing_prefix, cache);
+    }
 }
 
 Result<bool> verify_transaction(const Transaction& tx, uint32_t chain_id) {
-    // 1. Encode transaction without signatures
-    auto encoded_result = codec::encode_for_signing(tx);
-    if (encoded_result.is_err()) {
-        return Result<bool>::Err(encoded_result.error());
+    return verify_tx(tx, crypto::begin_signing_message(chain_id), nullptr);
+}
+
+Result<bool> verify_transaction(const Transaction& tx, uint32_t chain_id, VerifyCache& cache) {
+    return verify_tx(tx, crypto::begin_signing_message(chain_id), &cache);
+}
+
+Result<bool> verify_signatures(const Transaction& tx, const Hash32& message) {
+    return verify_tx_signatures(tx, message, nullptr);
+}
+
+Result<bool> verify_signatures(const Transaction& tx, const Hash32& message,
+                               VerifyCache& cache) {
+    return verify_tx_signatures(tx, message, &cache);
+}
+
+Result<bool> verify_encoded(ByteSpan wire, uint32_t chain_id) {
+    return verify_wire(wire, crypto::begin_signing_message(chain_id), nullptr);
+}
+
+Result<bool> verify_encoded(ByteSpan wire, uint32_t chain_id, VerifyCache& cache) {
+    return verify_wire(wire, crypto::begin_signing_message(chain_id), &cache);
+}
+
+Result<bool> verify_view(const TransactionView& view, uint32_t chain_id) {
+    return verify_decoded_view(view, crypto::begin_signing_message(chain_id), nullptr);
+}
+
+template<typename Params>
+Hash32 compute_signing_message(const BasicTransaction<Params>& tx, uint32_t chain_id) {
+    crypto::Sha256 hasher = crypto::begin_signing_message(chain_id);
+    codec::hash_for_signing(tx, hasher);
+    return hasher.final();
+}
+
+namespace {
+    template<size_t N>
+    Result<void> copy_signature(const Signature& sig, std::array<uint8_t, N>& out) {
+        if (sig.size() != N) {
+            return Result<void>::Err(Error(ErrorCode::InvalidSignature,
+                "Signature size mismatch: expected " + std::to_string(N) + ", got " +
+                std::to_string(sig.size())));
+        }
+        std::copy(sig.begin(), sig.end(), out.begin());
+        return Result<void>::Ok();
+    }
+}
+
+template<typename Params>
+Result<void> sign_transaction(BasicTransaction<Params>& tx, const std::vector<uint8_t>& privkey) {
+    const Hash32 message = compute_signing_message(tx, tx.chain_id);
+    
+    auto sig_result = crypto::sign(message, privkey, Params::algorithm);
+    if (sig_result.is_err()) {
+        return Result<void>::Err(sig_result.error());
     }
     
-    // 2. Create domain-separated signing message
-    auto msg_result = crypto::create_signing_message(chain_id, encoded_result.value());
-    if (msg_result.is_err()) {
-        return Result<bool>::Err(msg_result.error());
+    tx.auth_mode = AuthMode::PqOnly;
+    tx.classical_sig.fill(0);
+    return copy_signature(sig_result.value(), tx.pq_sig);
+}
+
+template<typename Params>
+Result<void> sign_transaction_hybrid(BasicTransaction<Params>& tx,
+                                     const std::vector<uint8_t>& pq_privkey,
+                                     const std::vector<uint8_t>& ed25519_privkey) {
+    const Hash32 message = compute_signing_message(tx, tx.chain_id);
+    
+    auto pq_sig_result = crypto::sign(message, pq_privkey, Params::algorithm);
+    if (pq_sig_result.is_err()) {
+        return Result<void>::Err(pq_sig_result.error());
     }
     
-    // 3. Verify signature(s)
-    if (tx.auth_mode == AuthMode::PqOnly) {
-        const auto& pq_sig = std::get<PqSignature>(tx.auth);
-        auto verify_result = crypto::verify(msg_result.value(), pq_sig.sig, tx.from_pubkey, "Dilithium3");
-        if (verify_result.is_err()) {
-            return Result<bool>::Err(verify_result.error());
-        }
-        return Result<bool>::Ok(verify_result.value());
-        
-    } else if (tx.auth_mode == AuthMode::Hybrid) {
-        const auto& hybrid_sig = std::get<HybridSignature>(tx.auth);
-        
-        // Verify both signatures
-        auto ed25519_result = crypto::ed25519_verify(msg_result.value(), hybrid_sig.classical_sig, tx.from_pubkey);
+    auto ed25519_sig_result = crypto::ed25519_sign(message, ed25519_privkey);
+    if (ed25519_sig_result.is_err()) {
+        return Result<void>::Err(ed25519_sig_result.error());
+    }
+    
+    tx.auth_mode = AuthMode::Hybrid;
+    auto classical_result = copy_signature(ed25519_sig_result.value(), tx.classical_sig);
+    if (classical_result.is_err()) {
+        return classical_result;
+    }
+    return copy_signature(pq_sig_result.value(), tx.pq_sig);
+}
+
+template<typename Params>
+Result<bool> verify_transaction(const BasicTransaction<Params>& tx, uint32_t chain_id) {
+    const Hash32 message = compute_signing_message(tx, chain_id);
+    
+    // Sizes are fixed by the type; only the parameter set's own verify runs
+    if (tx.auth_mode == AuthMode::Hybrid) {
+        auto ed25519_result = crypto::ed25519_verify(message, tx.classical_sig, tx.from_pubkey);
         if (ed25519_result.is_err()) {
             return Result<bool>::Err(ed25519_result.error());
         }
         if (!ed25519_result.value()) {
             return Result<bool>::Ok(false);
         }
-        
-        auto pq_result = crypto::verify(msg_result.value(), hybrid_sig.pq_sig, tx.from_pubkey, "Dilithium3");
-        if (pq_result.is_err()) {
-            return Result<bool>::Err(pq_result.error());
-        }
-        return Result<bool>::Ok(pq_result.value());
-        
-    } else {
+    } else if (tx.auth_mode != AuthMode::PqOnly) {
         return Result<bool>::Err(Error(ErrorCode::InvalidAuthTag, "Unknown auth mode"));
     }
+    return crypto::verify(message, tx.pq_sig, tx.from_pubkey, Params::algorithm);
 }
 
+template Hash32 compute_signing_message(const BasicTransaction<crypto::MlDsa44>&, uint32_t);
+template Hash32 compute_signing_message(const BasicTransaction<crypto::MlDsa65>&, uint32_t);
+template Hash32 compute_signing_message(const BasicTransaction<crypto::MlDsa87>&, uint32_t);
+template Result<void> sign_transaction(BasicTransaction<crypto::MlDsa44>&,
+                                       const std::vector<uint8_t>&);
+template Result<void> sign_transaction(BasicTransaction<crypto::MlDsa65>&,
+                                       const std::vector<uint8_t>&);
+template Result<void> sign_transaction(BasicTransaction<crypto::MlDsa87>&,
+                                       const std::vector<uint8_t>&);
+template Result<void> sign_transaction_hybrid(BasicTransaction<crypto::MlDsa44>&,
+                                              const std::vector<uint8_t>&,
+                                              const std::vector<uint8_t>&);
+template Result<void> sign_transaction_hybrid(BasicTransaction<crypto::MlDsa65>&,
+                                              const std::vector<uint8_t>&,
+                                              const std::vector<uint8_t>&);
+template Result<void> sign_transaction_hybrid(BasicTransaction<crypto::MlDsa87>&,
+                                              const std::vector<uint8_t>&,
+                                              const std::vector<uint8_t>&);
+template Result<bool> verify_transaction(const BasicTransaction<crypto::MlDsa44>&, uint32_t);
+template Result<bool> verify_transaction(const BasicTransaction<crypto::MlDsa65>&, uint32_t);
+template Result<bool> verify_transaction(const BasicTransaction<crypto::MlDsa87>&, uint32_t);
+
 } // namespace pqc_ledger::tx
 
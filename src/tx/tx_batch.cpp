@@ -0,0 +1,159 @@
+#include "pqc_ledger/tx/tx_batch.hpp"
+#include "pqc_ledger/codec/decode.hpp"
+#include "pqc_ledger/crypto/params.hpp"
+#include <variant>
+
+namespace pqc_ledger::tx {
+
+TxBatch::TxBatch(std::pmr::memory_resource* resource)
+    : versions_(resource),
+      chain_ids_(resource),
+      nonces_(resource),
+      amounts_(resource),
+      fees_(resource),
+      auth_modes_(resource),
+      recipients_(resource),
+      arena_(resource),
+      offsets_(1, 0, resource) {}
+
+void TxBatch::reserve(size_t count) {
+    versions_.reserve(count);
+    chain_ids_.reserve(count);
+    nonces_.reserve(count);
+    amounts_.reserve(count);
+    fees_.reserve(count);
+    auth_modes_.reserve(count);
+    recipients_.reserve(count);
+    arena_.reserve(count * (crypto::DefaultPqParams::pubkey_size +
+                            crypto::DefaultPqParams::signature_size));
+    offsets_.reserve(count * kFieldsPerTx + 1);
+}
+
+void TxBatch::clear() {
+    versions_.clear();
+    chain_ids_.clear();
+    nonces_.clear();
+    amounts_.clear();
+    fees_.clear();
+    auth_modes_.clear();
+    recipients_.clear();
+    arena_.clear();
+    offsets_.assign(1, 0);
+}
+
+void TxBatch::push_back(const TransactionView& view) {
+    append(view.version, view.chain_id, view.nonce, view.to, view.amount, view.fee,
+           view.auth_mode, view.from_pubkey, view.classical_sig, view.pq_sig);
+}
+
+void TxBatch::push_back(const Transaction& tx) {
+    ByteSpan classical_sig;
+    ByteSpan pq_sig;
+    if (const auto* hybrid = std::get_if<HybridSignature>(&tx.auth)) {
+        classical_sig = hybrid->classical_sig;
+        pq_sig = hybrid->pq_sig;
+    } else {
+        pq_sig = std::get<PqSignature>(tx.auth).sig;
+    }
+    append(tx.version, tx.chain_id, tx.nonce, tx.to, tx.amount, tx.fee, tx.auth_mode,
+           tx.from_pubkey, classical_sig, pq_sig);
+}
+
+void TxBatch::append(uint8_t version, uint32_t chain_id, uint64_t nonce, const Address& to,
+                     uint64_t amount, uint64_t fee, AuthMode auth_mode, ByteSpan pubkey,
+                     ByteSpan classical_sig, ByteSpan pq_sig) {
+    versions_.push_back(version);
+    chain_ids_.push_back(chain_id);
+    nonces_.push_back(nonce);
+    amounts_.push_back(amount);
+    fees_.push_back(fee);
+    auth_modes_.push_back(auth_mode);
+    recipients_.push_back(to);
+
+    for (ByteSpan bytes : {pubkey, classical_sig, pq_sig}) {
+        arena_.insert(arena_.end(), bytes.begin(), bytes.end());
+        offsets_.push_back(arena_.size());
+    }
+}
+
+TransactionView TxBatch::view(size_t index) const {
+    TransactionView view;
+    view.version = versions_[index];
+    view.chain_id = chain_ids_[index];
+    view.nonce = nonces_[index];
+    view.from_pubkey = pubkey(index);
+    view.to = recipients_[index];
+    view.amount = amounts_[index];
+    view.fee = fees_[index];
+    view.auth_mode = auth_modes_[index];
+    view.classical_sig = classical_sig(index);
+    view.pq_sig = pq_sig(index);
+    return view;
+}
+
+Transaction TxBatch::to_transaction(size_t index) const {
+    return view(index).to_transaction();
+}
+
+std::vector<BatchStatus> decode_batch(Span<const ByteSpan> inputs, TxBatch& out) {
+    std::vector<BatchStatus> statuses(inputs.size());
+    for (size_t i = 0; i < inputs.size(); ++i) {
+        TransactionView view;
+        if (codec::try_decode_view(inputs[i].data(), inputs[i].size(), view,
+                                   statuses[i].error)) {
+            out.push_back(view);
+            statuses[i].ok = true;
+        }
+    }
+    return statuses;
+}
+
+std::vector<BatchStatus> validate_cheap_checks_batch(const TxBatch& batch,
+                                                     uint32_t expected_chain_id) {
+    const size_t count = batch.size();
+    std::vector<BatchStatus> statuses(count, BatchStatus{true, ErrorCode::UnknownError});
+
+    // One pass per check, in validate_cheap_checks() order, so each transaction
+    // reports the first check it fails. The scalar passes read one column each.
+    auto check = [&](ErrorCode error, auto&& fails) {
+        for (size_t i = 0; i < count; ++i) {
+            if (statuses[i].ok && fails(i)) {
+                statuses[i] = BatchStatus{false, error};
+            }
+        }
+    };
+
+    const auto versions = batch.versions();
+    const auto chain_ids = batch.chain_ids();
+    const auto nonces = batch.nonces();
+    const auto amounts = batch.amounts();
+    const auto fees = batch.fees();
+    const auto auth_modes = batch.auth_modes();
+
+    check(ErrorCode::InvalidVersion, [&](size_t i) { return versions[i] != 1; });
+    check(ErrorCode::InvalidChainId, [&](size_t i) { return chain_ids[i] != expected_chain_id; });
+    check(ErrorCode::InvalidTransaction, [&](size_t i) { return nonces[i] == 0; });
+    check(ErrorCode::InvalidAmount, [&](size_t i) { return amounts[i] == 0; });
+    check(ErrorCode::InvalidFee, [&](size_t i) { return fees[i] == 0; });
+
+    // Sizes come from the offset index; the arena itself is never read
+    constexpr size_t expected_pubkey_size = crypto::DefaultPqParams::pubkey_size;
+    constexpr size_t expected_sig_size = crypto::DefaultPqParams::signature_size;
+    check(ErrorCode::InvalidPublicKey, [&](size_t i) {
+        return batch.pubkey(i).size() != expected_pubkey_size;
+    });
+    check(ErrorCode::InvalidAuthTag, [&](size_t i) {
+        return auth_modes[i] != AuthMode::PqOnly && auth_modes[i] != AuthMode::Hybrid;
+    });
+    check(ErrorCode::InvalidSignature, [&](size_t i) {
+        if (auth_modes[i] == AuthMode::Hybrid &&
+            batch.classical_sig(i).size() != ED25519_SIG_SIZE) {
+            return true;
+        }
+        return batch.pq_sig(i).size() != expected_sig_size;
+    });
+
+    return statuses;
+}
+
+} // namespace pqc_ledger::tx
@@ -1,7 +1,11 @@
 #include "pqc_ledger/tx/validation.hpp"
 #include "pqc_ledger/tx/signing.hpp"
-#include "pqc_ledger/crypto/pq.hpp"
+#include "pqc_ledger/crypto/params.hpp"
 #include "pqc_ledger/crypto/address.hpp"
+#include "pqc_ledger/codec/peek.hpp"
+#include "pqc_ledger/codec/archive.hpp"
+#include "pqc_ledger/basic_transaction.hpp"
+#include "codec/byte_order.hpp"
 
 namespace pqc_ledger::tx {
 
@@ -33,47 +37,37 @@ Result<void> validate_cheap_checks(const Transaction& tx, uint32_t expected_chai
     }
     
     // Public key size must match expected PQ algorithm size
-    // Default to Dilithium3
-    auto pubkey_size_result = crypto::get_pubkey_size("Dilithium3");
-    if (pubkey_size_result.is_err()) {
-        return Result<void>::Err(pubkey_size_result.error());
-    }
-    if (tx.from_pubkey.size() != pubkey_size_result.value()) {
+    // Default to ML-DSA-65 (Dilithium3); sizes come from the compile-time table
+    constexpr size_t expected_pubkey_size = crypto::DefaultPqParams::pubkey_size;
+    constexpr size_t expected_sig_size = crypto::DefaultPqParams::signature_size;
+    if (tx.from_pubkey.size() != expected_pubkey_size) {
         return Result<void>::Err(Error(ErrorCode::InvalidPublicKey,
-            "Public key size mismatch: expected " + std::to_string(pubkey_size_result.value()) +
+            "Public key size mismatch: expected " + std::to_string(expected_pubkey_size) +
             ", got " + std::to_string(tx.from_pubkey.size())));
     }
     
     // Validate auth mode and signature sizes
     if (tx.auth_mode == AuthMode::PqOnly) {
         const auto& pq_sig = std::get<PqSignature>(tx.auth);
-        auto sig_size_result = crypto::get_signature_size("Dilithium3");
-        if (sig_size_result.is_err()) {
-            return Result<void>::Err(sig_size_result.error());
-        }
-        if (pq_sig.sig.size() != sig_size_result.value()) {
+        if (pq_sig.sig.size() != expected_sig_size) {
             return Result<void>::Err(Error(ErrorCode::InvalidSignature,
-                "PQ signature size mismatch: expected " + std::to_string(sig_size_result.value()) +
+                "PQ signature size mismatch: expected " + std::to_string(expected_sig_size) +
                 ", got " + std::to_string(pq_sig.sig.size())));
         }
     } else if (tx.auth_mode == AuthMode::Hybrid) {
         const auto& hybrid_sig = std::get<HybridSignature>(tx.auth);
         
         // Check Ed25519 signature size
-        if (hybrid_sig.classical_sig.size() != 64) {
+        if (hybrid_sig.classical_sig.size() != ED25519_SIG_SIZE) {
             return Result<void>::Err(Error(ErrorCode::InvalidSignature,
                 "Ed25519 signature size mismatch: expected 64, got " +
                 std::to_string(hybrid_sig.classical_sig.size())));
         }
         
         // Check PQ signature size
-        auto sig_size_result = crypto::get_signature_size("Dilithium3");
-        if (sig_size_result.is_err()) {
-            return Result<void>::Err(sig_size_result.error());
-        }
-        if (hybrid_sig.pq_sig.size() != sig_size_result.value()) {
+        if (hybrid_sig.pq_sig.size() != expected_sig_size) {
             return Result<void>::Err(Error(ErrorCode::InvalidSignature,
-                "PQ signature size mismatch: expected " + std::to_string(sig_size_result.value()) +
+                "PQ signature size mismatch: expected " + std::to_string(expected_sig_size) +
                 ", got " + std::to_string(hybrid_sig.pq_sig.size())));
         }
     } else {
@@ -83,7 +77,78 @@ Result<void> validate_cheap_checks(const Transaction& tx, uint32_t expected_chai
     return Result<void>::Ok();
 }
 
+bool precheck_raw(ByteSpan wire, uint32_t expected_chain_id, ErrorCode& error) noexcept {
+    // Version, chain ID and nonce precede the public key, so their offsets do not
+    // depend on its length; check them before peek() rejects the key
+    if (wire.size() < FixedTransaction::kPubkeyLenOffset) {
+        error = ErrorCode::InvalidLengthPrefix;
+        return false;
+    }
+    if (wire.data()[0] != 1) {
+        error = ErrorCode::InvalidVersion;
+        return false;
+    }
+    if (codec::detail::load_u32_be(wire.data() + 1) != expected_chain_id) {
+        error = ErrorCode::InvalidChainId;
+        return false;
+    }
+    if (codec::detail::load_u64_be(wire.data() + 5) == 0) {
+        error = ErrorCode::InvalidTransaction;
+        return false;
+    }
+    
+    // Amount and fee sit after the key, at constant offsets only once peek() has
+    // checked its length
+    codec::TransactionHeader header;
+    if (!codec::peek(wire, header, error)) {
+        return false;
+    }
+    if (header.amount == 0) {
+        error = ErrorCode::InvalidAmount;
+        return false;
+    }
+    if (header.fee == 0) {
+        error = ErrorCode::InvalidFee;
+        return false;
+    }
+    
+    // The auth tag fixes the rest of the size
+    size_t expected_size = 0;
+    if (header.auth_tag == static_cast<uint8_t>(AuthMode::PqOnly)) {
+        expected_size = FixedTransaction::kPqOnlyEncodedSize;
+    } else if (header.auth_tag == static_cast<uint8_t>(AuthMode::Hybrid)) {
+        expected_size = FixedTransaction::kHybridEncodedSize;
+    } else {
+        error = ErrorCode::InvalidAuthTag;
+        return false;
+    }
+    if (wire.size() != expected_size) {
+        error = ErrorCode::InvalidSignature;
+        return false;
+    }
+    
+    return true;
+}
+
 Result<bool> validate_transaction(const Transaction& tx, uint32_t chain_id) {
+    return validate_transaction(tx, chain_id, ValidationOptions{});
+}
+
+namespace {
+    // VerifyCache key of a transaction's signatures over message
+    Hash32 cache_key(const VerifyCache& cache, const Transaction& tx, const Hash32& message) {
+        if (tx.auth_mode == AuthMode::Hybrid) {
+            const auto& hybrid_sig = std::get<HybridSignature>(tx.auth);
+            return cache.key(tx.auth_mode, message, tx.from_pubkey, hybrid_sig.classical_sig,
+                             hybrid_sig.pq_sig);
+        }
+        const auto& pq_sig = std::get<PqSignature>(tx.auth);
+        return cache.key(tx.auth_mode, message, tx.from_pubkey, ByteSpan(), pq_sig.sig);
+    }
+}
+
+Result<bool> validate_transaction(const Transaction& tx, uint32_t chain_id,
+                                  const ValidationOptions& options) {
     // DoS-aware ordering:
     // 1. Cheap structural checks first
     auto cheap_result = validate_cheap_checks(tx, chain_id);
@@ -91,12 +156,50 @@ Result<bool> validate_transaction(const Transaction& tx, uint32_t chain_id) {
         return Result<bool>::Ok(false);  // Invalid, but return false (not error)
     }
     
-    // 2. Expensive signature verification last
-    auto verify_result = verify_transaction(tx, chain_id);
+    if (options.rejects == nullptr) {
+        // 2. Expensive signature verification last (unless it already passed once)
+        return options.cache != nullptr ? verify_transaction(tx, chain_id, *options.cache)
+                                        : verify_transaction(tx, chain_id);
+    }
+    
+    // 2. Signatures that already verified are accepted before the reject filter
+    //    is asked, so a bloom false positive cannot drop them
+    auto message = compute_signing_message(tx, chain_id);
+    if (message.is_err()) {
+        return Result<bool>::Err(message.error());
+    }
+    Hash32 key{};
+    if (options.cache != nullptr) {
+        key = cache_key(*options.cache, tx, message.value());
+        if (options.cache->contains(key)) {
+            return Result<bool>::Ok(true);
+        }
+    }
+    
+    // 3. Known-bad transactions and senders, for the price of one hash rather
+    //    than a PQ verification
+    auto txid = codec::compute_txid(tx);
+    if (txid.is_err()) {
+        return Result<bool>::Err(txid.error());
+    }
+    if (options.rejects->is_rejected(txid.value(), tx.from_pubkey)) {
+        return Result<bool>::Err(Error(ErrorCode::RejectedByFilter,
+            "Transaction or sender recently failed verification; not verified"));
+    }
+    
+    // 4. Expensive signature verification last
+    auto verify_result = verify_signatures(tx, message.value());
     if (verify_result.is_err()) {
-        return Result<bool>::Err(verify_result.error());
+        return verify_result;
+    }
+    if (verify_result.value()) {
+        if (options.cache != nullptr) {
+            options.cache->insert(key);
+        }
+    } else {
+        options.rejects->record(txid.value(), tx.from_pubkey);
     }
-    return Result<bool>::Ok(verify_result.value());
+    return verify_result;
 }
 
 bool is_valid_structure(const Transaction& tx) {
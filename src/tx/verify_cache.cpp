@@ -0,0 +1,315 @@
+#include "pqc_ledger/tx/verify_cache.hpp"
+#include "pqc_ledger/crypto/hash.hpp"
+#include "pqc_ledger/codec/stream.hpp"
+#include "codec/byte_order.hpp"
+#include "util/mapped_file.hpp"
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <random>
+#include <system_error>
+#include <unordered_set>
+#include <vector>
+
+namespace pqc_ledger::tx {
+
+namespace {
+    // Keys are salted SHA-256 output, so any 8 of their bytes are a good hash
+    struct KeyHasher {
+        size_t operator()(const Hash32& key) const noexcept {
+            uint64_t word;
+            std::memcpy(&word, key.data(), sizeof(word));
+            return static_cast<size_t>(word);
+        }
+    };
+
+    size_t round_up_pow2(size_t value) {
+        size_t result = 1;
+        while (result < value) {
+            result <<= 1;
+        }
+        return result;
+    }
+
+    void update_sized(crypto::Sha256& hasher, ByteSpan field) {
+        const uint32_t size = static_cast<uint32_t>(field.size());
+        const uint8_t size_be[4] = {static_cast<uint8_t>(size >> 24),
+                                    static_cast<uint8_t>(size >> 16),
+                                    static_cast<uint8_t>(size >> 8),
+                                    static_cast<uint8_t>(size)};
+        hasher.update(size_be, sizeof(size_be));
+        hasher.update(field);
+    }
+
+    constexpr uint8_t kSnapshotMagic[4] = {'P', 'Q', 'V', 'C'};
+    constexpr size_t kKeySize = 32;
+    constexpr Hash32 kEmptySlot{};
+
+    // Home slot of a key in a snapshot table of slots (a power of two) entries
+    uint64_t home_slot(const uint8_t* key, uint64_t slots) {
+        return codec::detail::load_u64_be(key) & (slots - 1);
+    }
+
+    Error bad_snapshot(const std::string& path, const std::string& what) {
+        return Error(ErrorCode::InvalidSnapshot,
+                     "Invalid verify cache snapshot " + path + ": " + what);
+    }
+}
+
+// Padded to a cache line so that neighbouring shards' locks do not false-share
+struct alignas(64) VerifyCache::Shard {
+    std::mutex mutex;
+    std::unordered_set<Hash32, KeyHasher> keys;
+    std::vector<Hash32> order;  // Insertion ring; order[next] is the oldest once full
+    size_t next = 0;
+    VerifyCacheStats stats;
+};
+
+VerifyCache::VerifyCache(size_t capacity, size_t num_shards) {
+    const size_t shards = round_up_pow2(std::max<size_t>(1, num_shards));
+    shard_mask_ = shards - 1;
+    shard_capacity_ = std::max<size_t>(1, (capacity + shards - 1) / shards);
+    shards_ = std::make_unique<Shard[]>(shards);
+    for (size_t i = 0; i < shards; ++i) {
+        shards_[i].keys.reserve(shard_capacity_);
+    }
+
+    std::random_device random;
+    for (size_t i = 0; i < salt_.size(); i += 4) {
+        const uint32_t word = random();
+        std::memcpy(salt_.data() + i, &word, sizeof(word));
+    }
+}
+
+VerifyCache::~VerifyCache() = default;
+
+Hash32 VerifyCache::key(AuthMode auth_mode, const Hash32& message, ByteSpan pubkey,
+                        ByteSpan classical_sig, ByteSpan pq_sig) const noexcept {
+    crypto::Sha256 hasher;
+    hasher.update(salt_.data(), salt_.size());
+    const uint8_t mode = static_cast<uint8_t>(auth_mode);
+    hasher.update(&mode, 1);
+    hasher.update(message.data(), message.size());
+    update_sized(hasher, pubkey);
+    update_sized(hasher, classical_sig);
+    update_sized(hasher, pq_sig);
+    return hasher.final();
+}
+
+VerifyCache::Shard& VerifyCache::shard_for(const Hash32& key) const {
+    // Bytes independent of the ones KeyHasher uses inside the shard
+    uint64_t word;
+    std::memcpy(&word, key.data() + 8, sizeof(word));
+    return shards_[static_cast<size_t>(word) & shard_mask_];
+}
+
+bool VerifyCache::contains(const Hash32& key) {
+    Shard& shard = shard_for(key);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    const bool found = shard.keys.count(key) != 0;
+    ++(found ? shard.stats.hits : shard.stats.misses);
+    return found;
+}
+
+void VerifyCache::insert(const Hash32& key) {
+    Shard& shard = shard_for(key);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    if (!shard.keys.insert(key).second) {
+        return;  // Another thread verified the same signature concurrently
+    }
+    ++shard.stats.insertions;
+    if (shard.order.size() < shard_capacity_) {
+        shard.order.push_back(key);
+        return;
+    }
+    shard.keys.erase(shard.order[shard.next]);
+    shard.order[shard.next] = key;
+    shard.next = (shard.next + 1) % shard_capacity_;
+    ++shard.stats.evictions;
+}
+
+void VerifyCache::clear() {
+    for (size_t i = 0; i <= shard_mask_; ++i) {
+        std::lock_guard<std::mutex> lock(shards_[i].mutex);
+        shards_[i].keys.clear();
+        shards_[i].order.clear();
+        shards_[i].next = 0;
+    }
+}
+
+size_t VerifyCache::size() const {
+    size_t total = 0;
+    for (size_t i = 0; i <= shard_mask_; ++i) {
+        std::lock_guard<std::mutex> lock(shards_[i].mutex);
+        total += shards_[i].keys.size();
+    }
+    return total;
+}
+
+VerifyCacheStats VerifyCache::stats() const {
+    VerifyCacheStats total;
+    for (size_t i = 0; i <= shard_mask_; ++i) {
+        std::lock_guard<std::mutex> lock(shards_[i].mutex);
+        const VerifyCacheStats& shard = shards_[i].stats;
+        total.hits += shard.hits;
+        total.misses += shard.misses;
+        total.insertions += shard.insertions;
+        total.evictions += shard.evictions;
+    }
+    return total;
+}
+
+Result<void> VerifyCache::save(const std::string& path) const {
+    std::vector<Hash32> keys;
+    for (size_t i = 0; i <= shard_mask_; ++i) {
+        std::lock_guard<std::mutex> lock(shards_[i].mutex);
+        keys.insert(keys.end(), shards_[i].keys.begin(), shards_[i].keys.end());
+    }
+    keys.erase(std::remove(keys.begin(), keys.end(), kEmptySlot), keys.end());
+
+    // At most half full, so probe sequences stay short
+    const uint64_t slots = round_up_pow2(std::max<size_t>(16, keys.size() * 2));
+    std::vector<uint8_t> file(VerifyCacheSnapshot::HEADER_SIZE + slots * kKeySize, 0);
+    uint8_t* table = file.data() + VerifyCacheSnapshot::HEADER_SIZE;
+    for (const Hash32& key : keys) {
+        uint64_t slot = home_slot(key.data(), slots);
+        while (std::memcmp(table + slot * kKeySize, kEmptySlot.data(), kKeySize) != 0) {
+            slot = (slot + 1) & (slots - 1);
+        }
+        std::memcpy(table + slot * kKeySize, key.data(), kKeySize);
+    }
+
+    uint8_t* header = file.data();
+    std::memcpy(header, kSnapshotMagic, sizeof(kSnapshotMagic));
+    header[4] = VerifyCacheSnapshot::VERSION;
+    codec::detail::store_u64_be(header + 8, slots);
+    codec::detail::store_u64_be(header + 16, keys.size());
+    codec::detail::store_u32_be(header + 24,
+                                codec::crc32c(ByteSpan(table, slots * kKeySize)));
+    std::memcpy(header + 32, salt_.data(), salt_.size());
+
+    const std::string temp_path = path + ".tmp";
+    {
+        std::ofstream out(temp_path, std::ios::binary | std::ios::trunc);
+        if (!out.is_open()) {
+            return Result<void>::Err(Error(ErrorCode::FileWriteError,
+                "Cannot open file for writing: " + temp_path));
+        }
+        out.write(reinterpret_cast<const char*>(file.data()),
+                  static_cast<std::streamsize>(file.size()));
+        if (!out.flush()) {
+            return Result<void>::Err(Error(ErrorCode::FileWriteError,
+                "Cannot write file: " + temp_path));
+        }
+    }
+    std::error_code error;
+    std::filesystem::rename(temp_path, path, error);
+    if (error) {
+        std::filesystem::remove(temp_path, error);
+        return Result<void>::Err(Error(ErrorCode::FileWriteError,
+            "Cannot replace " + path + ": " + error.message()));
+    }
+    return Result<void>::Ok();
+}
+
+size_t VerifyCache::load(const VerifyCacheSnapshot& snapshot) {
+    clear();
+    salt_ = snapshot.salt_;
+
+    size_t loaded = 0;
+    for (uint64_t slot = 0; slot < snapshot.slots_ && loaded < capacity(); ++slot) {
+        const uint8_t* entry = snapshot.table_ + slot * kKeySize;
+        if (std::memcmp(entry, kEmptySlot.data(), kKeySize) == 0) {
+            continue;
+        }
+        Hash32 key;
+        std::memcpy(key.data(), entry, kKeySize);
+
+        // Fill shards directly: a full shard drops the key instead of evicting
+        // one that was loaded earlier, and the counters stay untouched
+        Shard& shard = shard_for(key);
+        if (shard.order.size() < shard_capacity_ && shard.keys.insert(key).second) {
+            shard.order.push_back(key);
+            ++loaded;
+        }
+    }
+    return loaded;
+}
+
+Result<size_t> VerifyCache::load(const std::string& path) {
+    auto snapshot = VerifyCacheSnapshot::open(path);
+    if (snapshot.is_err()) {
+        return Result<size_t>::Err(snapshot.error());
+    }
+    return Result<size_t>::Ok(load(snapshot.value()));
+}
+
+VerifyCacheSnapshot::VerifyCacheSnapshot() noexcept
+    : table_(nullptr), slots_(0), count_(0), salt_{} {}
+
+VerifyCacheSnapshot::~VerifyCacheSnapshot() = default;
+VerifyCacheSnapshot::VerifyCacheSnapshot(VerifyCacheSnapshot&& other) noexcept = default;
+VerifyCacheSnapshot& VerifyCacheSnapshot::operator=(VerifyCacheSnapshot&& other) noexcept =
+    default;
+
+Result<VerifyCacheSnapshot> VerifyCacheSnapshot::open(const std::string& path) {
+    auto mapped = util::MappedFile::open(path);
+    if (mapped.is_err()) {
+        return Result<VerifyCacheSnapshot>::Err(mapped.error());
+    }
+    const ByteSpan bytes = mapped.value().bytes();
+    const uint8_t* header = bytes.data();
+    if (bytes.size() < HEADER_SIZE ||
+        std::memcmp(header, kSnapshotMagic, sizeof(kSnapshotMagic)) != 0) {
+        return Result<VerifyCacheSnapshot>::Err(bad_snapshot(path, "bad magic"));
+    }
+    if (header[4] != VERSION) {
+        return Result<VerifyCacheSnapshot>::Err(
+            bad_snapshot(path, "unsupported version " + std::to_string(header[4])));
+    }
+
+    const uint64_t slots = codec::detail::load_u64_be(header + 8);
+    const uint64_t count = codec::detail::load_u64_be(header + 16);
+    const uint64_t table_size = bytes.size() - HEADER_SIZE;
+    if (slots == 0 || (slots & (slots - 1)) != 0 || table_size / kKeySize != slots ||
+        table_size % kKeySize != 0 || count >= slots) {
+        return Result<VerifyCacheSnapshot>::Err(
+            bad_snapshot(path, "table size does not match the header"));
+    }
+    const ByteSpan table(header + HEADER_SIZE, static_cast<size_t>(table_size));
+    if (codec::crc32c(table) != codec::detail::load_u32_be(header + 24)) {
+        return Result<VerifyCacheSnapshot>::Err(Error(ErrorCode::ChecksumMismatch,
+            "Verify cache snapshot " + path + " fails its checksum"));
+    }
+
+    VerifyCacheSnapshot snapshot;
+    snapshot.file_ = std::make_unique<util::MappedFile>(std::move(mapped.value()));
+    snapshot.table_ = table.data();
+    snapshot.slots_ = slots;
+    snapshot.count_ = count;
+    std::memcpy(snapshot.salt_.data(), header + 32, snapshot.salt_.size());
+    return Result<VerifyCacheSnapshot>::Ok(std::move(snapshot));
+}
+
+bool VerifyCacheSnapshot::contains(const Hash32& key) const noexcept {
+    if (slots_ == 0 || key == kEmptySlot) {
+        return false;
+    }
+    // Bounded by the table size in case a damaged table has no empty slot
+    uint64_t slot = home_slot(key.data(), slots_);
+    for (uint64_t probes = 0; probes < slots_; ++probes) {
+        const uint8_t* entry = table_ + slot * kKeySize;
+        if (std::memcmp(entry, key.data(), kKeySize) == 0) {
+            return true;
+        }
+        if (std::memcmp(entry, kEmptySlot.data(), kKeySize) == 0) {
+            return false;
+        }
+        slot = (slot + 1) & (slots_ - 1);
+    }
+    return false;
+}
+
+} // namespace pqc_ledger::tx
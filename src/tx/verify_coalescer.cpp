@@ -0,0 +1,88 @@
+#include "pqc_ledger/tx/verify_coalescer.hpp"
+#include "pqc_ledger/tx/signing.hpp"
+#include "pqc_ledger/codec/archive.hpp"
+#include "pqc_ledger/codec/encode.hpp"
+#include <cstring>
+#include <exception>
+#include <utility>
+
+namespace pqc_ledger::tx {
+
+size_t VerifyCoalescer::KeyHasher::operator()(const Key& key) const noexcept {
+    // txids are SHA-256 output, so 8 of their bytes are already a good hash
+    uint64_t word;
+    std::memcpy(&word, key.txid.data(), sizeof(word));
+    return static_cast<size_t>(word ^ key.chain_id);
+}
+
+VerifyCoalescer::VerifyCoalescer(VerifyCache* cache)
+    : cache_(cache), verifications_(0), coalesced_(0) {}
+
+Result<bool> VerifyCoalescer::run(const Hash32& txid, uint32_t chain_id,
+                                  const std::function<Result<bool>()>& verify) {
+    const Key key{txid, chain_id};
+    std::promise<Result<bool>> promise;
+    std::unique_lock<std::mutex> lock(mutex_);
+    auto it = flights_.find(key);
+    if (it != flights_.end()) {
+        std::shared_future<Result<bool>> flight = it->second;
+        lock.unlock();
+        coalesced_.fetch_add(1, std::memory_order_relaxed);
+        return flight.get();
+    }
+    flights_.emplace(key, promise.get_future().share());
+    lock.unlock();
+    verifications_.fetch_add(1, std::memory_order_relaxed);
+
+    // Release the key before publishing, so a request arriving after this
+    // point starts afresh (and, with a cache, hits it) rather than reading a
+    // finished flight
+    auto release = [&] {
+        lock.lock();
+        flights_.erase(key);
+        lock.unlock();
+    };
+    try {
+        Result<bool> result = verify();
+        release();
+        promise.set_value(result);
+        return result;
+    } catch (...) {
+        release();
+        promise.set_exception(std::current_exception());
+        throw;
+    }
+}
+
+Result<bool> VerifyCoalescer::verify_encoded(ByteSpan wire, uint32_t chain_id) {
+    return run(codec::compute_txid(wire), chain_id, [&]() {
+        return cache_ != nullptr ? tx::verify_encoded(wire, chain_id, *cache_)
+                                 : tx::verify_encoded(wire, chain_id);
+    });
+}
+
+Result<bool> VerifyCoalescer::verify_transaction(const Transaction& tx, uint32_t chain_id) {
+    auto verify = [&]() {
+        return cache_ != nullptr ? tx::verify_transaction(tx, chain_id, *cache_)
+                                 : tx::verify_transaction(tx, chain_id);
+    };
+    auto encoded = codec::encode(tx);
+    if (encoded.is_err()) {
+        return verify();  // No txid to coalesce on; reports the same error
+    }
+    return run(codec::compute_txid(encoded.value()), chain_id, verify);
+}
+
+size_t VerifyCoalescer::in_flight() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return flights_.size();
+}
+
+VerifyCoalescerStats VerifyCoalescer::stats() const {
+    VerifyCoalescerStats stats;
+    stats.verifications = verifications_.load(std::memory_order_relaxed);
+    stats.coalesced = coalesced_.load(std::memory_order_relaxed);
+    return stats;
+}
+
+} // namespace pqc_ledger::tx
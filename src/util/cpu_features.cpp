@@ -0,0 +1,74 @@
+#include "util/cpu_features.hpp"
+#include <cstdint>
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#define PQC_LEDGER_X86 1
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#endif
+
+namespace pqc_ledger::util {
+
+namespace {
+#ifdef PQC_LEDGER_X86
+    void cpuid(uint32_t leaf, uint32_t subleaf, uint32_t regs[4]) {
+#if defined(_MSC_VER)
+        int out[4];
+        __cpuidex(out, static_cast<int>(leaf), static_cast<int>(subleaf));
+        for (int i = 0; i < 4; ++i) {
+            regs[i] = static_cast<uint32_t>(out[i]);
+        }
+#else
+        __cpuid_count(leaf, subleaf, regs[0], regs[1], regs[2], regs[3]);
+#endif
+    }
+    
+    // XCR0: which register states the OS saves on context switch
+    uint64_t read_xcr0() {
+#if defined(_MSC_VER)
+        return _xgetbv(0);
+#else
+        uint32_t eax, edx;
+        __asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+        return (static_cast<uint64_t>(edx) << 32) | eax;
+#endif
+    }
+#endif
+    
+    CpuFeatures detect() {
+        CpuFeatures features;
+#ifdef PQC_LEDGER_X86
+        uint32_t regs[4];
+        cpuid(0, 0, regs);
+        uint32_t max_leaf = regs[0];
+        if (max_leaf < 1) {
+            return features;
+        }
+        
+        cpuid(1, 0, regs);
+        features.ssse3 = (regs[2] >> 9) & 1;
+        features.sse41 = (regs[2] >> 19) & 1;
+        features.sse42 = (regs[2] >> 20) & 1;
+        bool osxsave = (regs[2] >> 27) & 1;
+        bool avx = (regs[2] >> 28) & 1;
+        bool ymm_enabled = osxsave && (read_xcr0() & 0x6) == 0x6;
+        
+        if (max_leaf >= 7) {
+            cpuid(7, 0, regs);
+            features.avx2 = avx && ymm_enabled && ((regs[1] >> 5) & 1);
+            features.sha = (regs[1] >> 29) & 1;
+        }
+#endif
+        return features;
+    }
+}
+
+const CpuFeatures& cpu_features() {
+    static const CpuFeatures features = detect();
+    return features;
+}
+
+} // namespace pqc_ledger::util
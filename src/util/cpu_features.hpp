@@ -0,0 +1,22 @@
+#pragma once
+
+namespace pqc_ledger::util {
+
+/**
+ * Instruction-set extensions usable on the running CPU.
+ * Detected once with cpuid; everything is false on non-x86 targets.
+ */
+struct CpuFeatures {
+    bool ssse3 = false;
+    bool sse41 = false;
+    bool sse42 = false;  // Includes the CRC32 (Castagnoli) instruction
+    bool avx2 = false;  // Also requires OS support for saving YMM state
+    bool sha = false;   // SHA-NI (SHA-1/SHA-256 extensions)
+};
+
+/**
+ * Features of the running CPU (detected on first call, then cached).
+ */
+const CpuFeatures& cpu_features();
+
+} // namespace pqc_ledger::util
@@ -0,0 +1,123 @@
+#include "util/mapped_file.hpp"
+#include <cerrno>
+#include <cstring>
+#include <utility>
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace pqc_ledger::util {
+
+namespace {
+    Result<MappedFile> failed(const std::string& path, const char* what) {
+#if defined(_WIN32)
+        std::string reason = "error " + std::to_string(GetLastError());
+#else
+        std::string reason = std::strerror(errno);
+#endif
+        return Result<MappedFile>::Err(Error(ErrorCode::FileReadError,
+            "Cannot " + std::string(what) + " " + path + ": " + reason));
+    }
+}
+
+MappedFile::~MappedFile() {
+    unmap();
+}
+
+MappedFile::MappedFile(MappedFile&& other) noexcept
+    : data_(std::exchange(other.data_, nullptr)), size_(std::exchange(other.size_, 0)) {}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept {
+    if (this != &other) {
+        unmap();
+        data_ = std::exchange(other.data_, nullptr);
+        size_ = std::exchange(other.size_, 0);
+    }
+    return *this;
+}
+
+void MappedFile::unmap() noexcept {
+    if (data_ == nullptr) {
+        return;
+    }
+#if defined(_WIN32)
+    UnmapViewOfFile(data_);
+#else
+    munmap(const_cast<uint8_t*>(data_), size_);
+#endif
+    data_ = nullptr;
+    size_ = 0;
+}
+
+Result<MappedFile> MappedFile::open(const std::string& path) {
+    MappedFile mapped;
+#if defined(_WIN32)
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                              OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        return failed(path, "open");
+    }
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size)) {
+        auto error = failed(path, "stat");
+        CloseHandle(file);
+        return error;
+    }
+    if (size.QuadPart == 0) {
+        CloseHandle(file);
+        return Result<MappedFile>::Ok(std::move(mapped));
+    }
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (mapping == nullptr) {
+        auto error = failed(path, "map");
+        CloseHandle(file);
+        return error;
+    }
+    CloseHandle(file);  // The mapping holds its own reference to the file
+    void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (view == nullptr) {
+        auto error = failed(path, "map");
+        CloseHandle(mapping);
+        return error;
+    }
+    CloseHandle(mapping);  // The view keeps the mapping alive
+    mapped.data_ = static_cast<const uint8_t*>(view);
+    mapped.size_ = static_cast<size_t>(size.QuadPart);
+#else
+    int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return failed(path, "open");
+    }
+    struct stat info;
+    if (fstat(fd, &info) != 0) {
+        auto error = failed(path, "stat");
+        ::close(fd);
+        return error;
+    }
+    if (info.st_size == 0) {
+        ::close(fd);
+        return Result<MappedFile>::Ok(std::move(mapped));
+    }
+    void* view = mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_SHARED, fd, 0);
+    if (view == MAP_FAILED) {
+        auto error = failed(path, "map");
+        ::close(fd);
+        return error;
+    }
+    ::close(fd);  // The mapping holds its own reference to the file
+    mapped.data_ = static_cast<const uint8_t*>(view);
+    mapped.size_ = static_cast<size_t>(info.st_size);
+#endif
+    return Result<MappedFile>::Ok(std::move(mapped));
+}
+
+} // namespace pqc_ledger::util
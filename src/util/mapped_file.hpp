@@ -0,0 +1,45 @@
+#pragma once
+
+#include "pqc_ledger/error.hpp"
+#include "pqc_ledger/span.hpp"
+#include <string>
+
+namespace pqc_ledger::util {
+
+/**
+ * Read-only memory mapping of a whole file (mmap / MapViewOfFile).
+ *
+ * Mapping is O(1) in the file size: pages are read when first touched. The
+ * mapping stays valid until the object is destroyed, even if the file is
+ * closed or unlinked in the meantime; truncating the file underneath it does
+ * not, so mapped files must be treated as immutable.
+ */
+class MappedFile {
+public:
+    MappedFile() noexcept = default;
+    ~MappedFile();
+
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    /**
+     * Map a file for reading.
+     *
+     * @param path File to map
+     * @return Result containing the mapping (empty for an empty file), or
+     *         FileReadError if the file cannot be opened or mapped
+     */
+    static Result<MappedFile> open(const std::string& path);
+
+    ByteSpan bytes() const { return ByteSpan(data_, size_); }
+
+private:
+    void unmap() noexcept;
+
+    const uint8_t* data_ = nullptr;
+    size_t size_ = 0;
+};
+
+} // namespace pqc_ledger::util
@@ -0,0 +1,177 @@
+#include <gtest/gtest.h>
+#include "pqc_ledger/pqc_ledger.hpp"
+#include "test_util.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#if defined(_WIN32)
+#include <process.h>
+#define getpid _getpid
+#else
+#include <unistd.h>
+#endif
+
+using namespace pqc_ledger;
+
+std::vector<Transaction> make_txs(size_t count) {
+    std::vector<Transaction> txs;
+    for (uint64_t i = 1; i <= count; ++i) {
+        txs.push_back(make_tx(i, i % 4 == 0 ? AuthMode::Hybrid : AuthMode::PqOnly));
+    }
+    return txs;
+}
+
+std::vector<uint8_t> write_archive(const std::vector<Transaction>& txs) {
+    std::vector<uint8_t> archive;
+    codec::ArchiveWriter writer(codec::vector_sink(archive), 16 * 1024);
+    for (const auto& tx : txs) {
+        EXPECT_TRUE(writer.append(tx).is_ok());
+    }
+    EXPECT_EQ(writer.size(), txs.size());
+    EXPECT_TRUE(writer.finish().is_ok());
+    return archive;
+}
+
+void expect_archive_holds(const codec::ArchiveReader& reader,
+                          const std::vector<Transaction>& txs) {
+    ASSERT_EQ(reader.size(), txs.size());
+    EXPECT_TRUE(reader.verify().is_ok());
+
+    // Random access in reverse, then lookups by txid
+    for (size_t i = txs.size(); i-- > 0;) {
+        auto view = reader.at(i);
+        ASSERT_TRUE(view.is_ok()) << "tx " << i << ": " << view.error().message;
+        EXPECT_EQ(codec::encode(view.value().to_transaction()).value(),
+                  codec::encode(txs[i]).value()) << "tx " << i;
+    }
+    for (size_t i = 0; i < txs.size(); ++i) {
+        auto encoded = codec::encode(txs[i]).value();
+        uint64_t index = 0;
+        auto found = reader.find(codec::compute_txid(encoded), index);
+        ASSERT_TRUE(found.is_ok());
+        EXPECT_TRUE(found.value()) << "tx " << i;
+        EXPECT_EQ(index, i);
+    }
+
+    Hash32 unknown{};
+    uint64_t index = 0;
+    auto found = reader.find(unknown, index);
+    ASSERT_TRUE(found.is_ok());
+    EXPECT_FALSE(found.value());
+    EXPECT_TRUE(reader.at(txs.size()).is_err());
+}
+
+TEST(Archive, RoundTripInMemory) {
+    const auto txs = make_txs(20);
+    const auto archive = write_archive(txs);
+
+    auto reader = codec::ArchiveReader::over(archive);
+    ASSERT_TRUE(reader.is_ok()) << reader.error().message;
+    expect_archive_holds(reader.value(), txs);
+}
+
+TEST(Archive, EmptyArchive) {
+    const auto archive = write_archive({});
+    EXPECT_EQ(archive.size(), codec::ARCHIVE_HEADER_SIZE + 8 + codec::ARCHIVE_FOOTER_SIZE);
+
+    auto reader = codec::ArchiveReader::over(archive);
+    ASSERT_TRUE(reader.is_ok()) << reader.error().message;
+    expect_archive_holds(reader.value(), {});
+}
+
+TEST(Archive, MappedFileRoundTrip) {
+    const auto txs = make_txs(9);
+    const auto archive = write_archive(txs);
+
+    const std::string path = ::testing::TempDir() + "pqc_ledger_archive_" +
+                             std::to_string(getpid()) + ".bin";
+    std::FILE* file = std::fopen(path.c_str(), "wb");
+    ASSERT_NE(file, nullptr);
+    ASSERT_EQ(std::fwrite(archive.data(), 1, archive.size(), file), archive.size());
+    std::fclose(file);
+
+    {
+        auto reader = codec::ArchiveReader::open(path);
+        ASSERT_TRUE(reader.is_ok()) << reader.error().message;
+
+        // Moving the reader keeps views into the mapping valid
+        codec::ArchiveReader moved = std::move(reader.value());
+        auto view = moved.at(3);
+        ASSERT_TRUE(view.is_ok());
+        codec::ArchiveReader owner = std::move(moved);
+        EXPECT_EQ(view.value().nonce, txs[3].nonce);
+        expect_archive_holds(owner, txs);
+    }
+    std::remove(path.c_str());
+
+    auto missing = codec::ArchiveReader::open(path);
+    ASSERT_TRUE(missing.is_err());
+    EXPECT_EQ(missing.error().code, ErrorCode::FileReadError);
+}
+
+TEST(Archive, AppendEncodedRequiresCanonicalTransactions) {
+    std::vector<uint8_t> archive;
+    codec::ArchiveWriter writer(codec::vector_sink(archive));
+    auto encoded = codec::encode(make_tx(1, AuthMode::PqOnly)).value();
+    EXPECT_TRUE(writer.append_encoded(encoded).is_ok());
+
+    encoded.push_back(0x00);
+    EXPECT_EQ(writer.append_encoded(encoded).error().code, ErrorCode::TrailingBytes);
+    EXPECT_EQ(writer.size(), 1u);
+
+    ASSERT_TRUE(writer.finish().is_ok());
+    EXPECT_TRUE(writer.append(make_tx(2, AuthMode::PqOnly)).is_err());
+
+    auto reader = codec::ArchiveReader::over(archive);
+    ASSERT_TRUE(reader.is_ok());
+    EXPECT_EQ(reader.value().size(), 1u);
+}
+
+TEST(Archive, RejectsCorruptArchives) {
+    const auto txs = make_txs(3);
+    const auto archive = write_archive(txs);
+    const size_t footer = archive.size() - codec::ARCHIVE_FOOTER_SIZE;
+
+    auto open_error = [](const std::vector<uint8_t>& bytes) {
+        auto reader = codec::ArchiveReader::over(bytes);
+        return reader.is_err() ? reader.error().code : ErrorCode::UnknownError;
+    };
+
+    auto bad_magic = archive;
+    bad_magic[0] = 'X';
+    EXPECT_EQ(open_error(bad_magic), ErrorCode::InvalidArchive);
+
+    auto truncated = archive;
+    truncated.pop_back();
+    EXPECT_EQ(open_error(truncated), ErrorCode::InvalidArchive);
+
+    auto bad_count = archive;
+    bad_count[footer + 7] ^= 0x01;
+    EXPECT_EQ(open_error(bad_count), ErrorCode::InvalidArchive);
+
+    auto huge_count = archive;
+    std::fill(huge_count.begin() + footer, huge_count.begin() + footer + 8, 0xff);
+    EXPECT_EQ(open_error(huge_count), ErrorCode::InvalidArchive);
+
+    // Start of transaction 1 pushed past transaction 2: opens, fails on access to
+    // the two transactions that index entry bounds, not to the third
+    const size_t index_offset = footer - 3 * codec::ARCHIVE_TXID_ENTRY_SIZE - 4 * 8;
+    auto bad_offset = archive;
+    bad_offset[index_offset + 8 + 6] ^= 0x40;
+    auto reader = codec::ArchiveReader::over(bad_offset);
+    ASSERT_TRUE(reader.is_ok());
+    EXPECT_TRUE(reader.value().at(0).is_err());
+    EXPECT_TRUE(reader.value().at(2).is_ok());
+    EXPECT_EQ(reader.value().at(1).error().code, ErrorCode::InvalidArchive);
+    EXPECT_EQ(reader.value().verify().error().code, ErrorCode::ChecksumMismatch);
+
+    // A flipped signature byte keeps the layout but breaks the txid
+    auto bad_tx = archive;
+    bad_tx[index_offset - 1] ^= 0x01;
+    auto tampered = codec::ArchiveReader::over(bad_tx);
+    ASSERT_TRUE(tampered.is_ok());
+    EXPECT_TRUE(tampered.value().at(2).is_ok());
+    EXPECT_EQ(tampered.value().verify().error().code, ErrorCode::InvalidArchive);
+}
@@ -0,0 +1,125 @@
+#include <gtest/gtest.h>
+#include "pqc_ledger/pqc_ledger.hpp"
+#include "test_util.hpp"
+#include <vector>
+#include <algorithm>
+
+using namespace pqc_ledger;
+
+TEST(BasicTransaction, EncodingMatchesDynamic) {
+    for (AuthMode mode : {AuthMode::PqOnly, AuthMode::Hybrid}) {
+        Transaction tx = make_tx(12345, mode);
+        auto fixed = FixedTransaction::from_transaction(tx);
+        ASSERT_TRUE(fixed.is_ok()) << fixed.error().message;
+
+        auto expected = codec::encode(tx);
+        auto actual = codec::encode(fixed.value());
+        ASSERT_TRUE(expected.is_ok());
+        ASSERT_TRUE(actual.is_ok());
+        EXPECT_EQ(actual.value(), expected.value());
+        EXPECT_EQ(fixed.value().encoded_size(), expected.value().size());
+
+        FixedTransaction decoded;
+        auto decode_result = codec::decode(expected.value(), decoded);
+        ASSERT_TRUE(decode_result.is_ok()) << decode_result.error().message;
+        auto reencoded = codec::encode(decoded.to_transaction());
+        ASSERT_TRUE(reencoded.is_ok());
+        EXPECT_EQ(reencoded.value(), expected.value());
+
+        auto message = tx::compute_signing_message(tx, 1);
+        ASSERT_TRUE(message.is_ok());
+        EXPECT_EQ(tx::compute_signing_message(decoded, 1), message.value());
+    }
+}
+
+TEST(BasicTransaction, DecodeReportsSameErrors) {
+    auto encoded = codec::encode(make_tx(12345, AuthMode::PqOnly));
+    ASSERT_TRUE(encoded.is_ok());
+    const auto& valid = encoded.value();
+
+    std::vector<std::vector<uint8_t>> inputs;
+    inputs.push_back({});
+    inputs.push_back(std::vector<uint8_t>(valid.begin(), valid.begin() + 14));
+    inputs.push_back(std::vector<uint8_t>(valid.begin(), valid.end() - 1));
+    auto trailing = valid;
+    trailing.push_back(0x00);
+    inputs.push_back(trailing);
+    auto bad_version = valid;
+    bad_version[0] = 2;
+    inputs.push_back(bad_version);
+    auto bad_tag = valid;
+    bad_tag[FixedTransaction::kAuthTagOffset] = 7;
+    inputs.push_back(bad_tag);
+    auto bad_pubkey_len = valid;
+    bad_pubkey_len[FixedTransaction::kPubkeyLenOffset + 1] ^= 0x01;
+    inputs.push_back(bad_pubkey_len);
+
+    for (const auto& input : inputs) {
+        auto expected = codec::decode(input);
+        ASSERT_TRUE(expected.is_err());
+
+        FixedTransaction fixed;
+        auto actual = codec::decode(input, fixed);
+        ASSERT_TRUE(actual.is_err());
+        EXPECT_EQ(actual.error().code, expected.error().code);
+    }
+
+    // Unsigned encodings decode dynamically but have no fixed-size form
+    Transaction unsigned_tx = make_tx(12345, AuthMode::PqOnly);
+    unsigned_tx.auth = PqSignature{{}};
+    auto unsigned_encoded = codec::encode(unsigned_tx);
+    ASSERT_TRUE(unsigned_encoded.is_ok());
+    ASSERT_TRUE(codec::decode(unsigned_encoded.value()).is_ok());
+    FixedTransaction fixed;
+    auto unsigned_result = codec::decode(unsigned_encoded.value(), fixed);
+    ASSERT_TRUE(unsigned_result.is_err());
+    EXPECT_EQ(unsigned_result.error().code, ErrorCode::InvalidSignature);
+}
+
+TEST(BasicTransaction, FromTransactionChecksSizes) {
+    Transaction tx = make_tx(12345, AuthMode::PqOnly);
+    tx.from_pubkey.pop_back();
+    auto bad_pubkey = FixedTransaction::from_transaction(tx);
+    ASSERT_TRUE(bad_pubkey.is_err());
+    EXPECT_EQ(bad_pubkey.error().code, ErrorCode::InvalidPublicKey);
+
+    tx = make_tx(12345, AuthMode::PqOnly);
+    tx.auth_mode = AuthMode::Hybrid;
+    auto mismatched = FixedTransaction::from_transaction(tx);
+    ASSERT_TRUE(mismatched.is_err());
+    EXPECT_EQ(mismatched.error().code, ErrorCode::InvalidAuthTag);
+
+    // Other parameter sets reject ML-DSA-65 sizes
+    tx = make_tx(12345, AuthMode::PqOnly);
+    EXPECT_TRUE(BasicTransaction<crypto::MlDsa44>::from_transaction(tx).is_err());
+}
+
+TEST(BasicTransaction, SignVerify) {
+    auto keypair_result = crypto::generate_keypair("Dilithium3");
+    ASSERT_TRUE(keypair_result.is_ok()) << "Key generation failed";
+    const auto& [pubkey, privkey] = keypair_result.value();
+
+    Transaction unsigned_tx = make_tx(12345, AuthMode::PqOnly);
+    unsigned_tx.from_pubkey = pubkey;
+    unsigned_tx.auth = PqSignature{{}};
+    auto fixed_result = FixedTransaction::from_transaction(unsigned_tx);
+    ASSERT_TRUE(fixed_result.is_ok()) << fixed_result.error().message;
+    FixedTransaction fixed = fixed_result.value();
+
+    auto sign_result = tx::sign_transaction(fixed, privkey);
+    ASSERT_TRUE(sign_result.is_ok()) << sign_result.error().message;
+
+    auto verify_result = tx::verify_transaction(fixed, 1);
+    ASSERT_TRUE(verify_result.is_ok());
+    EXPECT_TRUE(verify_result.value());
+
+    // The dynamic path accepts the same signature
+    auto dynamic_result = tx::verify_transaction(fixed.to_transaction(), 1);
+    ASSERT_TRUE(dynamic_result.is_ok());
+    EXPECT_TRUE(dynamic_result.value());
+
+    fixed.amount += 1;
+    auto tampered = tx::verify_transaction(fixed, 1);
+    ASSERT_TRUE(tampered.is_ok());
+    EXPECT_FALSE(tampered.value());
+}
@@ -0,0 +1,71 @@
+#include <gtest/gtest.h>
+#include "pqc_ledger/pqc_ledger.hpp"
+#include "test_util.hpp"
+#include <vector>
+#include <algorithm>
+
+using namespace pqc_ledger;
+
+TEST(BatchVerify, EmptyBatch) {
+    std::vector<Transaction> txs;
+    auto outcomes = tx::verify_batch(txs, 1);
+    EXPECT_TRUE(outcomes.empty());
+}
+
+TEST(BatchVerify, MatchesSerialVerification) {
+    auto txs = create_signed_txs(32);
+    ASSERT_EQ(txs.size(), 32u) << "Failed to create signed transactions";
+
+    // Tamper with every third transaction
+    for (size_t i = 0; i < txs.size(); i += 3) {
+        txs[i].amount += 1;
+    }
+
+    for (size_t threads : {1, 2, 4, 8}) {
+        tx::BatchVerifyOptions options;
+        options.num_threads = threads;
+        options.min_per_thread = 1;
+
+        auto outcomes = tx::verify_batch(txs, 1, options);
+        ASSERT_EQ(outcomes.size(), txs.size());
+
+        // Results must be reported in input order
+        for (size_t i = 0; i < txs.size(); ++i) {
+            auto serial = tx::verify_transaction(txs[i], 1);
+            ASSERT_TRUE(serial.is_ok());
+            auto expected = serial.value() ? tx::VerifyStatus::Valid : tx::VerifyStatus::Invalid;
+            EXPECT_EQ(outcomes[i].status, expected) << "Mismatch at index " << i
+                                                    << " with " << threads << " threads";
+        }
+    }
+}
+
+TEST(BatchVerify, WrongChainIdIsInvalid) {
+    auto txs = create_signed_txs(8);
+    ASSERT_EQ(txs.size(), 8u) << "Failed to create signed transactions";
+
+    auto outcomes = tx::verify_batch(txs, 2);
+    for (const auto& outcome : outcomes) {
+        EXPECT_EQ(outcome.status, tx::VerifyStatus::Invalid)
+            << "Domain separation must reject signatures from another chain";
+    }
+}
+
+TEST(BatchVerify, MalformedTransactionReportsError) {
+    auto txs = create_signed_txs(4);
+    ASSERT_EQ(txs.size(), 4u) << "Failed to create signed transactions";
+
+    // auth_mode disagrees with the auth payload
+    txs[1].auth_mode = AuthMode::Hybrid;
+
+    tx::BatchVerifyOptions options;
+    options.num_threads = 2;
+    options.min_per_thread = 1;
+
+    auto outcomes = tx::verify_batch(txs, 1, options);
+    ASSERT_EQ(outcomes.size(), 4u);
+    EXPECT_EQ(outcomes[0].status, tx::VerifyStatus::Valid);
+    EXPECT_EQ(outcomes[1].status, tx::VerifyStatus::Error);
+    EXPECT_EQ(outcomes[2].status, tx::VerifyStatus::Valid);
+    EXPECT_EQ(outcomes[3].status, tx::VerifyStatus::Valid);
+}
@@ -5,6 +5,7 @@
 #include <sstream>
 #include <iomanip>
 #include <cctype>
+#include <algorithm>
 
 using namespace pqc_ledger;
 
@@ -119,6 +120,139 @@ TEST(CodecHex, DecodeInvalid) {
     // Note: hex_to_bytes_test doesn't have error handling, so we skip those tests
 }
 
+// Reference encoding the vector kernels are checked against
+std::string reference_hex(const std::vector<uint8_t>& bytes) {
+    std::ostringstream oss;
+    oss << std::hex << std::setfill('0');
+    for (uint8_t byte : bytes) {
+        oss << std::setw(2) << static_cast<int>(byte);
+    }
+    return oss.str();
+}
+
+const codec::HexBackend kHexBackends[] = {codec::HexBackend::Portable, codec::HexBackend::Ssse3,
+                                          codec::HexBackend::Avx2};
+
+TEST(CodecHex, BackendsMatchReference) {
+    EXPECT_TRUE(codec::hex_backend_available(codec::hex_backend()));
+    
+    // Lengths around the 16- and 32-byte blocks and a signed transaction's size
+    for (size_t size : {0, 1, 15, 16, 17, 31, 32, 33, 63, 64, 65, 100, 5300}) {
+        std::vector<uint8_t> bytes(size);
+        for (size_t i = 0; i < size; ++i) {
+            bytes[i] = static_cast<uint8_t>(i * 37 + 11);
+        }
+        const std::string expected = reference_hex(bytes);
+        std::string upper = expected;
+        std::transform(upper.begin(), upper.end(), upper.begin(),
+                       [](unsigned char c) { return static_cast<char>(std::toupper(c)); });
+        
+        for (auto backend : kHexBackends) {
+            if (!codec::hex_backend_available(backend)) {
+                continue;
+            }
+            const char* name = codec::hex_backend_name(backend);
+            
+            std::string encoded(codec::hex_encoded_size(size), '\0');
+            codec::hex_encode_into(bytes, encoded.data(), backend);
+            EXPECT_EQ(encoded, expected) << name << " size " << size;
+            
+            for (const std::string& text : {expected, upper}) {
+                std::vector<uint8_t> decoded(size);
+                auto written = codec::hex_decode_into(text, decoded, backend);
+                ASSERT_TRUE(written.is_ok()) << name << " size " << size;
+                EXPECT_EQ(written.value(), size);
+                EXPECT_EQ(decoded, bytes) << name << " size " << size;
+            }
+        }
+    }
+}
+
+TEST(CodecHex, DecodeSkipsWhitespaceAnywhere) {
+    std::vector<uint8_t> bytes(80);
+    for (size_t i = 0; i < bytes.size(); ++i) {
+        bytes[i] = static_cast<uint8_t>(255 - i);
+    }
+    std::string hex = codec::hex_encode(bytes);
+    
+    // Line-wrapped, and a split digit pair in the middle of a vector block
+    std::string wrapped;
+    for (size_t i = 0; i < hex.size(); ++i) {
+        if (i > 0 && i % 40 == 0) {
+            wrapped += "\r\n";
+        }
+        if (i == 71) {
+            wrapped += " \t";
+        }
+        wrapped += hex[i];
+    }
+    
+    for (auto backend : kHexBackends) {
+        if (!codec::hex_backend_available(backend)) {
+            continue;
+        }
+        std::vector<uint8_t> decoded(wrapped.size() / 2);
+        auto written = codec::hex_decode_into(wrapped, decoded, backend);
+        ASSERT_TRUE(written.is_ok()) << codec::hex_backend_name(backend);
+        decoded.resize(written.value());
+        EXPECT_EQ(decoded, bytes) << codec::hex_backend_name(backend);
+    }
+}
+
+TEST(CodecHex, DecodeReportsFirstInvalidCharacter) {
+    const std::vector<uint8_t> bytes(70, 0x5a);
+    const std::string valid = codec::hex_encode(bytes);
+    
+    for (auto backend : kHexBackends) {
+        if (!codec::hex_backend_available(backend)) {
+            continue;
+        }
+        const char* name = codec::hex_backend_name(backend);
+        std::vector<uint8_t> out(valid.size() / 2);
+        
+        for (size_t pos : {0, 1, 15, 31, 32, 63, 64, 100, 139}) {
+            for (char bad : {'g', 'G', '/', ':', '@', '`', '\x80', '\0'}) {
+                std::string text = valid;
+                text[pos] = bad;
+                auto result = codec::hex_decode_into(text, out, backend);
+                ASSERT_TRUE(result.is_err()) << name << " pos " << pos;
+                EXPECT_EQ(result.error().code, ErrorCode::InvalidHexEncoding);
+                EXPECT_EQ(result.error().message,
+                          "Invalid hex character at position " + std::to_string(pos))
+                    << name;
+            }
+        }
+        
+        auto odd = codec::hex_decode_into(valid.substr(1), out, backend);
+        ASSERT_TRUE(odd.is_err()) << name;
+        EXPECT_EQ(odd.error().code, ErrorCode::InvalidHexEncoding);
+        
+        // Output one byte short: the last pair has nowhere to go
+        std::vector<uint8_t> short_out(valid.size() / 2 - 1);
+        auto overflow = codec::hex_decode_into(valid, short_out, backend);
+        ASSERT_TRUE(overflow.is_err()) << name;
+        EXPECT_EQ(overflow.error().code, ErrorCode::MismatchedLength);
+    }
+}
+
+TEST(CodecHex, AddressHexIsStrict) {
+    Address addr;
+    for (size_t i = 0; i < addr.size(); ++i) {
+        addr[i] = static_cast<uint8_t>(i * 7);
+    }
+    std::string hex = crypto::address_to_hex(addr);
+    EXPECT_EQ(hex, reference_hex(std::vector<uint8_t>(addr.begin(), addr.end())));
+    
+    auto parsed = crypto::address_from_hex(hex);
+    ASSERT_TRUE(parsed.is_ok());
+    EXPECT_EQ(parsed.value(), addr);
+    
+    // std::stoul used to accept these
+    EXPECT_TRUE(crypto::address_from_hex("0x" + hex.substr(2)).is_err());
+    EXPECT_TRUE(crypto::address_from_hex(" f" + hex.substr(2)).is_err());
+    EXPECT_TRUE(crypto::address_from_hex(hex.substr(2)).is_err());
+}
+
 // Test base64 encoding/decoding
 TEST(CodecBase64, EncodeDecodeRoundTrip) {
     // Test various byte sequences
@@ -207,6 +341,142 @@ TEST(CodecBase64, DecodeInvalid) {
     EXPECT_TRUE(codec::decode_from_base64("Zg!=").is_err());  // Invalid character
 }
 
+const codec::Base64Backend kBase64Backends[] = {codec::Base64Backend::Portable,
+                                                codec::Base64Backend::Ssse3,
+                                                codec::Base64Backend::Avx2};
+
+std::vector<uint8_t> base64_test_bytes(size_t size) {
+    std::vector<uint8_t> bytes(size);
+    for (size_t i = 0; i < size; ++i) {
+        bytes[i] = static_cast<uint8_t>(i * 89 + 7);
+    }
+    return bytes;
+}
+
+TEST(CodecBase64, BackendsMatchPortable) {
+    EXPECT_TRUE(codec::base64_backend_available(codec::base64_backend()));
+    const std::vector<uint8_t> foob = {0x66, 0x6F, 0x6F, 0x62};
+    EXPECT_EQ(codec::base64_encode(foob), "Zm9vYg==");
+    
+    // Lengths around the 12- and 24-byte blocks and a signed transaction's size
+    for (size_t size : {0, 1, 2, 3, 11, 12, 13, 15, 16, 24, 27, 28, 29, 47, 48, 100, 5300}) {
+        const auto bytes = base64_test_bytes(size);
+        std::string expected(codec::base64_encoded_size(size), '\0');
+        codec::base64_encode_into(bytes, expected.data(), codec::Base64Backend::Portable);
+        EXPECT_EQ(base64_to_bytes_test(expected), bytes) << "size " << size;
+        
+        for (auto backend : kBase64Backends) {
+            if (!codec::base64_backend_available(backend)) {
+                continue;
+            }
+            const char* name = codec::base64_backend_name(backend);
+            
+            std::string encoded(codec::base64_encoded_size(size), '\0');
+            codec::base64_encode_into(bytes, encoded.data(), backend);
+            EXPECT_EQ(encoded, expected) << name << " size " << size;
+            
+            std::vector<uint8_t> decoded(expected.size() / 4 * 3);
+            auto written = codec::base64_decode_into(expected, decoded, backend);
+            ASSERT_TRUE(written.is_ok()) << name << " size " << size;
+            decoded.resize(written.value());
+            EXPECT_EQ(decoded, bytes) << name << " size " << size;
+        }
+    }
+}
+
+TEST(CodecBase64, BackendsClassifyEveryCharacterAlike) {
+    const auto bytes = base64_test_bytes(48);
+    const std::string valid = codec::base64_encode(bytes);
+    
+    // Every byte value, inside the first vector block and inside the second
+    for (size_t pos : {5, 37}) {
+        for (int c = 0; c < 256; ++c) {
+            std::string text = valid;
+            text[pos] = static_cast<char>(c);
+            
+            std::vector<uint8_t> expected_out(text.size());
+            auto expected = codec::base64_decode_into(text, expected_out,
+                                                      codec::Base64Backend::Portable);
+            for (auto backend : kBase64Backends) {
+                if (!codec::base64_backend_available(backend)) {
+                    continue;
+                }
+                std::vector<uint8_t> out(text.size());
+                auto result = codec::base64_decode_into(text, out, backend);
+                ASSERT_EQ(result.is_ok(), expected.is_ok())
+                    << codec::base64_backend_name(backend) << " char " << c;
+                if (result.is_ok()) {
+                    EXPECT_EQ(out, expected_out) << codec::base64_backend_name(backend);
+                } else {
+                    EXPECT_EQ(result.error().message, expected.error().message);
+                }
+            }
+        }
+    }
+}
+
+TEST(CodecBase64, DecoderAcceptsAnyChunking) {
+    const auto bytes = base64_test_bytes(1000);
+    const std::string flat = codec::base64_encode(bytes);
+    
+    // MIME-style line wrapping
+    std::string wrapped;
+    for (size_t i = 0; i < flat.size(); i += 76) {
+        wrapped += flat.substr(i, 76) + "\r\n";
+    }
+    
+    for (auto backend : kBase64Backends) {
+        if (!codec::base64_backend_available(backend)) {
+            continue;
+        }
+        for (size_t chunk_size : {1, 2, 3, 5, 7, 64, 333, 5000}) {
+            codec::Base64Decoder decoder(backend);
+            std::vector<uint8_t> decoded;
+            for (size_t i = 0; i < wrapped.size(); i += chunk_size) {
+                std::string_view chunk = std::string_view(wrapped).substr(i, chunk_size);
+                std::vector<uint8_t> out(codec::Base64Decoder::max_output_size(chunk.size()));
+                auto written = decoder.update(chunk, out);
+                ASSERT_TRUE(written.is_ok()) << codec::base64_backend_name(backend);
+                decoded.insert(decoded.end(), out.begin(), out.begin() + written.value());
+            }
+            EXPECT_TRUE(decoder.finish().is_ok());
+            EXPECT_EQ(decoded, bytes) << codec::base64_backend_name(backend)
+                                      << " chunk " << chunk_size;
+        }
+    }
+}
+
+TEST(CodecBase64, DecodeRejectsMalformedText) {
+    auto error_of = [](const std::string& text) {
+        auto result = codec::base64_decode(text);
+        EXPECT_TRUE(result.is_err()) << text;
+        return result.is_err() ? result.error().message : std::string();
+    };
+    EXPECT_EQ(error_of("Zg="), "Invalid base64 string: incomplete group");
+    EXPECT_EQ(error_of("Z==="), "Invalid base64 string: misplaced padding");
+    EXPECT_EQ(error_of("Zg=a"), "Invalid base64 string: misplaced padding");
+    EXPECT_EQ(error_of("Zg==Zg=="), "Invalid base64 string: data after padding");
+    EXPECT_EQ(error_of("Zm9v Yg!="), "Invalid base64 character at position 7");
+    
+    // Whitespace may follow the padding
+    auto trailing = codec::base64_decode("Zg==\n");
+    ASSERT_TRUE(trailing.is_ok());
+    EXPECT_EQ(trailing.value(), std::vector<uint8_t>{0x66});
+    
+    // Positions count from the start of the stream, not the chunk
+    codec::Base64Decoder decoder;
+    std::vector<uint8_t> out(16);
+    ASSERT_TRUE(decoder.update("Zm9vYmFy", out).is_ok());
+    auto bad = decoder.update("Zm*v", out);
+    ASSERT_TRUE(bad.is_err());
+    EXPECT_EQ(bad.error().message, "Invalid base64 character at position 10");
+    
+    std::vector<uint8_t> small(5);
+    auto overflow = codec::base64_decode_into("Zm9vYmFy", small);
+    ASSERT_TRUE(overflow.is_err());
+    EXPECT_EQ(overflow.error().code, ErrorCode::MismatchedLength);
+}
+
 // Test transaction encoding/decoding with hex/base64
 TEST(CodecTransaction, EncodeDecodeHexRoundTrip) {
     Transaction tx;
@@ -307,3 +577,171 @@ TEST(CodecTransaction, HexBase64Equivalence) {
     EXPECT_EQ(encoded_hex.value(), binary_result.value());
 }
 
+
+// Test zero-copy view decoding
+TEST(CodecView, ViewBorrowsInputBuffer) {
+    Transaction tx;
+    tx.version = 1;
+    tx.chain_id = 7;
+    tx.nonce = 12345;
+    tx.from_pubkey = std::vector<uint8_t>(1952, 0x42);
+    tx.to = {};
+    std::fill(tx.to.begin(), tx.to.end(), 0xAA);
+    tx.amount = 1000;
+    tx.fee = 10;
+    tx.auth_mode = AuthMode::Hybrid;
+    tx.auth = HybridSignature{std::vector<uint8_t>(64, 0x11), std::vector<uint8_t>(3309, 0x22)};
+    
+    auto encoded = codec::encode(tx);
+    ASSERT_TRUE(encoded.is_ok());
+    const auto& bytes = encoded.value();
+    
+    auto view = codec::decode_view(bytes.data(), bytes.size());
+    ASSERT_TRUE(view.is_ok()) << view.error().message;
+    
+    // Variable-length fields point into the input buffer
+    const uint8_t* begin = bytes.data();
+    const uint8_t* end = bytes.data() + bytes.size();
+    EXPECT_EQ(view.value().from_pubkey.data(), begin + 1 + 4 + 8 + 2);
+    EXPECT_TRUE(view.value().pq_sig.data() > begin && view.value().pq_sig.data() < end);
+    EXPECT_TRUE(view.value().classical_sig.data() > begin &&
+                view.value().classical_sig.data() < end);
+    EXPECT_EQ(view.value().chain_id, 7u);
+    EXPECT_EQ(view.value().classical_sig.size(), 64u);
+    EXPECT_EQ(view.value().pq_sig.size(), 3309u);
+    
+    // Converting to an owning transaction round-trips
+    auto reencoded = codec::encode(view.value().to_transaction());
+    ASSERT_TRUE(reencoded.is_ok());
+    EXPECT_EQ(reencoded.value(), bytes);
+}
+
+TEST(CodecView, ViewAppliesStrictRules) {
+    Transaction tx;
+    tx.version = 1;
+    tx.chain_id = 1;
+    tx.nonce = 12345;
+    tx.from_pubkey = std::vector<uint8_t>(1952, 0x42);
+    tx.to = {};
+    tx.amount = 1000;
+    tx.fee = 10;
+    tx.auth_mode = AuthMode::PqOnly;
+    tx.auth = PqSignature{std::vector<uint8_t>(3309, 0x55)};
+    
+    auto encoded = codec::encode(tx);
+    ASSERT_TRUE(encoded.is_ok());
+    auto bytes = encoded.value();
+    bytes.push_back(0x00);
+    
+    auto trailing = codec::decode_view(bytes.data(), bytes.size());
+    ASSERT_TRUE(trailing.is_err());
+    EXPECT_EQ(trailing.error().code, ErrorCode::TrailingBytes);
+    
+    auto truncated = codec::decode_view(bytes.data(), 100);
+    ASSERT_TRUE(truncated.is_err());
+    EXPECT_EQ(truncated.error().code, ErrorCode::MismatchedLength);
+    
+    EXPECT_TRUE(codec::decode_view(nullptr, 0).is_err());
+}
+
+// Test encoding into caller-provided buffers
+TEST(CodecEncodeInto, MatchesEncode) {
+    Transaction tx;
+    tx.version = 1;
+    tx.chain_id = 7;
+    tx.nonce = 12345;
+    tx.from_pubkey = std::vector<uint8_t>(1952, 0x42);
+    tx.to = {};
+    std::fill(tx.to.begin(), tx.to.end(), 0xAA);
+    tx.amount = 1000;
+    tx.fee = 10;
+    tx.auth_mode = AuthMode::Hybrid;
+    tx.auth = HybridSignature{std::vector<uint8_t>(64, 0x11), std::vector<uint8_t>(3309, 0x22)};
+    
+    auto encoded = codec::encode(tx);
+    ASSERT_TRUE(encoded.is_ok());
+    const auto& expected = encoded.value();
+    EXPECT_EQ(codec::encoded_size(tx), expected.size());
+    
+    // Exact-size buffer
+    std::vector<uint8_t> buffer(expected.size());
+    auto written = codec::encode_into(tx, buffer);
+    ASSERT_TRUE(written.is_ok());
+    EXPECT_EQ(written.value(), expected.size());
+    EXPECT_EQ(buffer, expected);
+    
+    // Too small: error, buffer untouched
+    std::vector<uint8_t> small(expected.size() - 1, 0xEE);
+    auto too_small = codec::encode_into(tx, small);
+    ASSERT_TRUE(too_small.is_err());
+    EXPECT_EQ(too_small.error().code, ErrorCode::MismatchedLength);
+    EXPECT_TRUE(std::all_of(small.begin(), small.end(), [](uint8_t b) { return b == 0xEE; }));
+    
+    // Appending keeps existing contents
+    std::vector<uint8_t> appended = {0x01, 0x02};
+    ASSERT_TRUE(codec::encode_append(tx, appended).is_ok());
+    ASSERT_EQ(appended.size(), 2 + expected.size());
+    EXPECT_TRUE(std::equal(expected.begin(), expected.end(), appended.begin() + 2));
+}
+
+TEST(CodecEncodeInto, RejectsUnencodable) {
+    Transaction tx;
+    tx.version = 1;
+    tx.chain_id = 1;
+    tx.from_pubkey = std::vector<uint8_t>(1952, 0x42);
+    tx.to = {};
+    tx.auth_mode = AuthMode::Hybrid;
+    tx.auth = PqSignature{std::vector<uint8_t>(3309, 0x55)};  // Disagrees with auth_mode
+    
+    std::vector<uint8_t> out;
+    auto mismatched = codec::encode_append(tx, out);
+    ASSERT_TRUE(mismatched.is_err());
+    EXPECT_EQ(mismatched.error().code, ErrorCode::InvalidAuthTag);
+    EXPECT_TRUE(out.empty());
+    
+    tx.auth_mode = AuthMode::PqOnly;
+    tx.from_pubkey.assign(70000, 0x42);  // Does not fit the u16 length prefix
+    auto oversized = codec::encode(tx);
+    ASSERT_TRUE(oversized.is_err());
+    EXPECT_EQ(oversized.error().code, ErrorCode::InvalidPublicKey);
+}
+
+TEST(CodecPeek, ReadsFieldsInPlace) {
+    Transaction tx;
+    tx.version = 1;
+    tx.chain_id = 0x01020304;
+    tx.nonce = 0x1122334455667788ULL;
+    tx.from_pubkey = std::vector<uint8_t>(1952, 0x42);
+    for (size_t i = 0; i < tx.to.size(); ++i) {
+        tx.to[i] = static_cast<uint8_t>(i);
+    }
+    tx.amount = 1000;
+    tx.fee = 10;
+    tx.auth_mode = AuthMode::Hybrid;
+    tx.auth = HybridSignature{std::vector<uint8_t>(64, 0x11), std::vector<uint8_t>(3309, 0x55)};
+    
+    auto encoded = codec::encode(tx);
+    ASSERT_TRUE(encoded.is_ok());
+    const auto& bytes = encoded.value();
+    
+    codec::TransactionHeader header;
+    ErrorCode error = ErrorCode::UnknownError;
+    ASSERT_TRUE(codec::peek(bytes, header, error));
+    EXPECT_EQ(header.version, tx.version);
+    EXPECT_EQ(header.chain_id, tx.chain_id);
+    EXPECT_EQ(header.nonce, tx.nonce);
+    EXPECT_EQ(header.to, tx.to);
+    EXPECT_EQ(header.amount, tx.amount);
+    EXPECT_EQ(header.fee, tx.fee);
+    EXPECT_EQ(header.auth_tag, 1);
+    
+    // Only the prefix through the auth tag is needed
+    ASSERT_TRUE(codec::peek(ByteSpan(bytes.data(), 1952 + 64), header, error));
+    EXPECT_FALSE(codec::peek(ByteSpan(bytes.data(), 1952 + 63), header, error));
+    EXPECT_EQ(error, ErrorCode::InvalidLengthPrefix);
+    
+    auto other_key_size = bytes;
+    other_key_size[14] ^= 0x01;
+    EXPECT_FALSE(codec::peek(other_key_size, header, error));
+    EXPECT_EQ(error, ErrorCode::InvalidPublicKey);
+}
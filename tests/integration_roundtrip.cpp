@@ -35,7 +35,7 @@ TEST(IntegrationRoundtrip, EncodeDecodeEncode) {
 }
 
 TEST(IntegrationRoundtrip, SignVerify) {
-    // SHA256 is now always available via picosha2
+    // SHA256 is always available (built-in implementation)
     
     // Generate keypair
     auto keypair_result = crypto::generate_keypair("Dilithium3");
@@ -79,3 +79,182 @@ TEST(IntegrationRoundtrip, SignVerify) {
     }
 }
 
+
+TEST(IntegrationRoundtrip, ParamTableMatchesLiboqs) {
+    // The compile-time sizes used by the codec must agree with the linked liboqs
+    auto check = crypto::check_pq_params();
+    EXPECT_TRUE(check.is_ok()) << (check.is_err() ? check.error().message : "");
+    
+    auto pubkey_size = crypto::get_pubkey_size(crypto::PqAlgorithm::MlDsa65);
+    ASSERT_TRUE(pubkey_size.is_ok());
+    EXPECT_EQ(pubkey_size.value(), crypto::MlDsa65::pubkey_size);
+    
+    auto sig_size = crypto::get_signature_size(crypto::PqAlgorithm::MlDsa65);
+    ASSERT_TRUE(sig_size.is_ok());
+    EXPECT_EQ(sig_size.value(), crypto::MlDsa65::signature_size);
+}
+
+TEST(IntegrationRoundtrip, StreamingSha256MatchesOneShot) {
+    // FIPS 180-2 test vector for "abc"
+    const uint8_t abc[] = {'a', 'b', 'c'};
+    auto abc_digest = crypto::Sha256().update(abc, sizeof(abc)).final();
+    EXPECT_EQ(codec::encode_to_hex(std::vector<uint8_t>(abc_digest.begin(), abc_digest.end())),
+              "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad");
+    
+    // Splitting the input at any point (including across block and padding
+    // boundaries) must not change the digest
+    for (size_t size : {0, 1, 55, 56, 63, 64, 65, 127, 128, 2100}) {
+        std::vector<uint8_t> data(size);
+        for (size_t i = 0; i < size; ++i) {
+            data[i] = static_cast<uint8_t>(i * 31 + 7);
+        }
+        auto expected = crypto::sha256(data);
+        ASSERT_TRUE(expected.is_ok());
+        
+        for (size_t split : {size_t{0}, size / 3, size / 2, size}) {
+            crypto::Sha256 hasher;
+            hasher.update(data.data(), split);
+            hasher.update(data.data() + split, size - split);
+            auto digest = hasher.final();
+            EXPECT_EQ(digest, expected.value())
+                << "size " << size << " split " << split;
+        }
+    }
+}
+
+TEST(IntegrationRoundtrip, Sha256BackendsAgree) {
+    const crypto::Sha256Backend backends[] = {crypto::Sha256Backend::Portable,
+                                              crypto::Sha256Backend::ShaNi,
+                                              crypto::Sha256Backend::OpenSsl};
+    EXPECT_TRUE(crypto::sha256_backend_available(crypto::sha256_backend()));
+    
+    for (size_t size : {0, 3, 55, 64, 119, 1952, 4096}) {
+        std::vector<uint8_t> data(size);
+        for (size_t i = 0; i < size; ++i) {
+            data[i] = static_cast<uint8_t>(i * 131 + 17);
+        }
+        auto expected = crypto::sha256(data, crypto::Sha256Backend::Portable);
+        ASSERT_TRUE(expected.is_ok());
+        
+        for (auto backend : backends) {
+            auto digest = crypto::sha256(data, backend);
+            if (!crypto::sha256_backend_available(backend)) {
+                EXPECT_TRUE(digest.is_err()) << crypto::sha256_backend_name(backend);
+                continue;
+            }
+            ASSERT_TRUE(digest.is_ok()) << crypto::sha256_backend_name(backend);
+            EXPECT_EQ(digest.value(), expected.value())
+                << crypto::sha256_backend_name(backend) << " size " << size;
+            
+            // Streaming through the backend's block function
+            crypto::Sha256 hasher(backend);
+            hasher.update(data.data(), size / 2);
+            hasher.update(data.data() + size / 2, size - size / 2);
+            EXPECT_EQ(hasher.final(), expected.value())
+                << crypto::sha256_backend_name(backend) << " size " << size;
+        }
+    }
+}
+
+TEST(IntegrationRoundtrip, Sha256ManyMatchesSingle) {
+    // Mixed lengths (padding in one or two blocks) and partial lane groups
+    std::vector<std::vector<uint8_t>> messages;
+    for (size_t i = 0; i < 19; ++i) {
+        size_t size = (i % 3 == 0) ? PQ_PUBKEY_SIZE : i * 13;
+        std::vector<uint8_t> data(size);
+        for (size_t j = 0; j < size; ++j) {
+            data[j] = static_cast<uint8_t>(i * 7 + j);
+        }
+        messages.push_back(std::move(data));
+    }
+    
+    for (size_t count : {0, 1, 8, 9, 19}) {
+        std::vector<ByteSpan> inputs(messages.begin(), messages.begin() + count);
+        
+        for (auto backend : {crypto::Sha256Backend::Portable, crypto::Sha256Backend::ShaNi,
+                             crypto::Sha256Backend::OpenSsl, crypto::Sha256Backend::Avx2}) {
+            if (!crypto::sha256_backend_available(backend)) {
+                continue;
+            }
+            std::vector<Hash32> outputs(count);
+            auto result = crypto::sha256_many(inputs, outputs, backend);
+            ASSERT_TRUE(result.is_ok()) << crypto::sha256_backend_name(backend);
+            
+            for (size_t i = 0; i < count; ++i) {
+                auto expected = crypto::sha256(messages[i]);
+                ASSERT_TRUE(expected.is_ok());
+                EXPECT_EQ(outputs[i], expected.value())
+                    << crypto::sha256_backend_name(backend) << " message " << i;
+            }
+        }
+    }
+    
+    // Output span must match the input count
+    std::vector<ByteSpan> inputs(messages.begin(), messages.begin() + 2);
+    std::vector<Hash32> outputs(1);
+    EXPECT_TRUE(crypto::sha256_many(inputs, outputs).is_err());
+}
+
+TEST(IntegrationRoundtrip, DeriveAddressesMatchesSingle) {
+    std::vector<PublicKey> pubkeys;
+    for (size_t i = 0; i < 11; ++i) {
+        pubkeys.emplace_back(PQ_PUBKEY_SIZE, static_cast<uint8_t>(i));
+    }
+    std::vector<ByteSpan> inputs(pubkeys.begin(), pubkeys.end());
+    std::vector<Address> addresses(pubkeys.size());
+    
+    auto result = crypto::derive_addresses(inputs, addresses);
+    ASSERT_TRUE(result.is_ok()) << (result.is_err() ? result.error().message : "");
+    
+    for (size_t i = 0; i < pubkeys.size(); ++i) {
+        auto expected = crypto::derive_address(pubkeys[i]);
+        ASSERT_TRUE(expected.is_ok());
+        EXPECT_EQ(addresses[i], expected.value()) << "key " << i;
+    }
+}
+
+TEST(IntegrationRoundtrip, SinglePassSignAndEncode) {
+    auto keypair_result = crypto::generate_keypair("Dilithium3");
+    ASSERT_TRUE(keypair_result.is_ok()) << "Key generation failed";
+    const auto& [pubkey, privkey] = keypair_result.value();
+    
+    Transaction tx;
+    tx.version = 1;
+    tx.chain_id = 7;
+    tx.nonce = 12345;
+    tx.from_pubkey = pubkey;
+    std::fill(tx.to.begin(), tx.to.end(), 0xAA);
+    tx.amount = 1000;
+    tx.fee = 10;
+    tx.auth_mode = AuthMode::PqOnly;
+    tx.auth = PqSignature{{}};
+    
+    // encode_with_sighash is encode() and compute_signing_message() in one pass
+    auto combined = codec::encode_with_sighash(tx, tx.chain_id);
+    ASSERT_TRUE(combined.is_ok());
+    auto encoded = codec::encode(tx);
+    ASSERT_TRUE(encoded.is_ok());
+    auto message = tx::compute_signing_message(tx, tx.chain_id);
+    ASSERT_TRUE(message.is_ok());
+    EXPECT_EQ(combined.value().bytes, encoded.value());
+    EXPECT_EQ(combined.value().sighash, message.value());
+    
+    // sign_and_encode_transaction produces exactly what sign-then-encode does
+    Transaction separate = tx;
+    ASSERT_TRUE(tx::sign_transaction(separate, privkey).is_ok());
+    auto expected = codec::encode(separate);
+    ASSERT_TRUE(expected.is_ok());
+    
+    auto signed_bytes = tx::sign_and_encode_transaction(tx, privkey);
+    ASSERT_TRUE(signed_bytes.is_ok()) << signed_bytes.error().message;
+    auto reencoded = codec::encode(tx);
+    ASSERT_TRUE(reencoded.is_ok());
+    EXPECT_EQ(signed_bytes.value(), reencoded.value());
+    EXPECT_EQ(signed_bytes.value().size(), expected.value().size());
+    
+    auto decoded = codec::decode(signed_bytes.value());
+    ASSERT_TRUE(decoded.is_ok());
+    auto verify_result = tx::verify_transaction(decoded.value(), tx.chain_id);
+    ASSERT_TRUE(verify_result.is_ok());
+    EXPECT_TRUE(verify_result.value());
+}
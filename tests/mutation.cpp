@@ -2,10 +2,12 @@
 #include "pqc_ledger/pqc_ledger.hpp"
 #include <vector>
 #include <algorithm>
+#include <memory>
+#include <memory_resource>
 
 using namespace pqc_ledger;
 
-// SHA256 is now always available via picosha2, no need to check
+// SHA256 is always available (built-in implementation), no need to check
 
 // Helper to create and sign a valid transaction
 std::pair<Transaction, std::vector<uint8_t>> create_and_sign_tx() {
@@ -330,3 +332,116 @@ TEST(Mutation, LengthPrefixExceedsBuffer) {
     }
 }
 
+
+TEST(Mutation, NonThrowingDecoderReportsSameErrors) {
+    Transaction tx;
+    tx.version = 1;
+    tx.chain_id = 1;
+    tx.nonce = 12345;
+    tx.from_pubkey = std::vector<uint8_t>(1952, 0x42);
+    tx.to = {};
+    std::fill(tx.to.begin(), tx.to.end(), 0xAA);
+    tx.amount = 1000;
+    tx.fee = 10;
+    tx.auth_mode = AuthMode::PqOnly;
+    tx.auth = PqSignature{std::vector<uint8_t>(3309, 0x55)};  // ML-DSA-65 sig size
+    
+    auto encoded = codec::encode(tx);
+    ASSERT_TRUE(encoded.is_ok());
+    const auto& valid = encoded.value();
+    
+    std::vector<std::vector<uint8_t>> inputs;
+    inputs.push_back(std::vector<uint8_t>(valid.begin(), valid.begin() + 3));     // Truncated chain_id
+    inputs.push_back(std::vector<uint8_t>(valid.begin(), valid.begin() + 14));    // Truncated length prefix
+    inputs.push_back(std::vector<uint8_t>(valid.begin(), valid.end() - 1));       // Truncated signature
+    auto trailing = valid;
+    trailing.push_back(0x00);
+    inputs.push_back(trailing);
+    auto bad_version = valid;
+    bad_version[0] = 2;
+    inputs.push_back(bad_version);
+    auto bad_tag = valid;
+    bad_tag[1 + 4 + 8 + 2 + 1952 + 32 + 8 + 8] = 7;
+    inputs.push_back(bad_tag);
+    
+    for (const auto& input : inputs) {
+        auto decoded = codec::decode(input);
+        ASSERT_TRUE(decoded.is_err());
+        
+        TransactionView view;
+        ErrorCode error = ErrorCode::UnknownError;
+        EXPECT_FALSE(codec::try_decode_view(input.data(), input.size(), view, error));
+        EXPECT_EQ(error, decoded.error().code);
+    }
+    
+    TransactionView view;
+    ErrorCode error = ErrorCode::UnknownError;
+    EXPECT_TRUE(codec::try_decode_view(valid.data(), valid.size(), view, error));
+}
+
+TEST(Mutation, VerifyEncodedMatchesDecodeThenVerify) {
+    auto [tx, encoded] = create_and_sign_tx();
+    ASSERT_FALSE(encoded.empty()) << "Failed to create and sign transaction";
+    
+    auto valid = tx::verify_encoded(encoded, 1);
+    ASSERT_TRUE(valid.is_ok()) << valid.error().message;
+    EXPECT_TRUE(valid.value());
+    
+    auto other_chain = tx::verify_encoded(encoded, 2);
+    ASSERT_TRUE(other_chain.is_ok());
+    EXPECT_FALSE(other_chain.value()) << "Domain separation must apply to wire verification";
+    
+    // Flip one byte in every field; the wire path must agree with decode + verify
+    const size_t offsets[] = {0, 1, 5, 13, 15, 1967, 1999, 2007, 2015, 2018, encoded.size() - 1};
+    for (size_t offset : offsets) {
+        auto mut_data = encoded;
+        mut_data[offset] ^= 0x01;
+        
+        auto wire_result = tx::verify_encoded(mut_data, 1);
+        auto decoded = codec::decode(mut_data);
+        if (decoded.is_err()) {
+            ASSERT_TRUE(wire_result.is_err()) << "offset " << offset;
+            EXPECT_EQ(wire_result.error().code, decoded.error().code) << "offset " << offset;
+            continue;
+        }
+        auto struct_result = tx::verify_transaction(decoded.value(), 1);
+        ASSERT_TRUE(wire_result.is_ok()) << "offset " << offset;
+        ASSERT_TRUE(struct_result.is_ok()) << "offset " << offset;
+        EXPECT_EQ(wire_result.value(), struct_result.value()) << "offset " << offset;
+        EXPECT_FALSE(wire_result.value()) << "offset " << offset;
+    }
+}
+
+TEST(Mutation, DecodeIntoArenaVerifiesAfterInputIsGone) {
+    auto [tx, encoded] = create_and_sign_tx();
+    ASSERT_FALSE(encoded.empty()) << "Failed to create and sign transaction";
+    
+    // Room for exactly one encoding; the null upstream makes any extra allocation throw
+    std::vector<uint8_t> region(encoded.size());
+    std::pmr::monotonic_buffer_resource arena(region.data(), region.size(),
+                                              std::pmr::null_memory_resource());
+    
+    // Rejected inputs take nothing from the arena
+    auto truncated = encoded;
+    truncated.pop_back();
+    auto rejected = codec::decode_into(truncated, &arena);
+    ASSERT_TRUE(rejected.is_err());
+    EXPECT_EQ(rejected.error().code, codec::decode(truncated).error().code);
+    
+    auto wire = std::make_unique<std::vector<uint8_t>>(encoded);
+    auto view_result = codec::decode_into(*wire, &arena);
+    ASSERT_TRUE(view_result.is_ok()) << view_result.error().message;
+    wire.reset();
+    
+    const TransactionView& view = view_result.value();
+    EXPECT_GE(view.from_pubkey.data(), region.data());
+    EXPECT_LT(view.pq_sig.data(), region.data() + region.size());
+    
+    auto verify_result = tx::verify_view(view, 1);
+    ASSERT_TRUE(verify_result.is_ok()) << verify_result.error().message;
+    EXPECT_TRUE(verify_result.value());
+    
+    auto reencoded = codec::encode(view.to_transaction());
+    ASSERT_TRUE(reencoded.is_ok());
+    EXPECT_EQ(reencoded.value(), encoded);
+}
@@ -5,7 +5,7 @@
 using namespace pqc_ledger;
 
 TEST(Replay, DifferentChainId) {
-    // SHA256 is now always available via picosha2
+    // SHA256 is always available (built-in implementation)
     
     // Generate keypair
     auto keypair_result = crypto::generate_keypair("Dilithium3");
@@ -47,7 +47,7 @@ TEST(Replay, DifferentChainId) {
 }
 
 TEST(Replay, DomainSeparation) {
-    // SHA256 is now always available via picosha2
+    // SHA256 is always available (built-in implementation)
     
     // Test that the signing message includes chain_id
     // This is tested indirectly through the create_signing_message function
@@ -81,3 +81,30 @@ TEST(Replay, DomainSeparation) {
         "Signing messages for different chain_ids should differ";
 }
 
+
+TEST(Replay, StreamingSigningMessageMatchesBuffered) {
+    Transaction tx;
+    tx.version = 1;
+    tx.chain_id = 1;
+    tx.nonce = 12345;
+    tx.from_pubkey = std::vector<uint8_t>(1952, 0x42);
+    tx.to = {};
+    std::fill(tx.to.begin(), tx.to.end(), 0xAA);
+    tx.amount = 1000;
+    tx.fee = 10;
+    tx.auth_mode = AuthMode::PqOnly;
+    tx.auth = PqSignature{std::vector<uint8_t>(3309, 0x55)};
+    
+    auto encoded = codec::encode_for_signing(tx);
+    ASSERT_TRUE(encoded.is_ok());
+    
+    for (uint32_t chain_id : {1u, 2u, 0xDEADBEEFu}) {
+        auto buffered = crypto::create_signing_message(chain_id, encoded.value());
+        ASSERT_TRUE(buffered.is_ok());
+        
+        auto streamed = tx::compute_signing_message(tx, chain_id);
+        ASSERT_TRUE(streamed.is_ok());
+        
+        EXPECT_EQ(streamed.value(), buffered.value()) << "chain_id " << chain_id;
+    }
+}
@@ -0,0 +1,61 @@
+#pragma once
+
+// Fixtures shared by the test suites
+
+#include "pqc_ledger/pqc_ledger.hpp"
+#include <algorithm>
+#include <vector>
+
+// Helper to create an (unsigned-content) transaction with correctly sized fields
+inline pqc_ledger::Transaction make_tx(uint64_t nonce, pqc_ledger::AuthMode auth_mode) {
+    using namespace pqc_ledger;
+
+    Transaction tx;
+    tx.version = 1;
+    tx.chain_id = 1;
+    tx.nonce = nonce;
+    tx.from_pubkey = std::vector<uint8_t>(PQ_PUBKEY_SIZE, static_cast<uint8_t>(nonce));
+    std::fill(tx.to.begin(), tx.to.end(), static_cast<uint8_t>(0xA0 + nonce));
+    tx.amount = 1000 + nonce;
+    tx.fee = 10 + nonce;
+    tx.auth_mode = auth_mode;
+    if (auth_mode == AuthMode::Hybrid) {
+        tx.auth = HybridSignature{std::vector<uint8_t>(ED25519_SIG_SIZE, 0x11),
+                                  std::vector<uint8_t>(PQ_SIG_SIZE, 0x22)};
+    } else {
+        tx.auth = PqSignature{std::vector<uint8_t>(PQ_SIG_SIZE, 0x33)};
+    }
+    return tx;
+}
+
+// Helper to create signed transactions from one keypair
+inline std::vector<pqc_ledger::Transaction> create_signed_txs(size_t count) {
+    using namespace pqc_ledger;
+
+    auto keypair_result = crypto::generate_keypair("Dilithium3");
+    if (!keypair_result.is_ok()) {
+        return {};
+    }
+
+    const auto& [pubkey, privkey] = keypair_result.value();
+
+    std::vector<Transaction> txs;
+    for (size_t i = 0; i < count; ++i) {
+        Transaction tx;
+        tx.version = 1;
+        tx.chain_id = 1;
+        tx.nonce = i + 1;
+        tx.from_pubkey = pubkey;
+        std::fill(tx.to.begin(), tx.to.end(), 0xAA);
+        tx.amount = 1000 + i;
+        tx.fee = 10;
+        tx.auth_mode = AuthMode::PqOnly;
+        tx.auth = PqSignature{{}};
+
+        if (!tx::sign_transaction(tx, privkey, "Dilithium3").is_ok()) {
+            return {};
+        }
+        txs.push_back(std::move(tx));
+    }
+    return txs;
+}
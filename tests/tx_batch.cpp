@@ -0,0 +1,142 @@
+#include <gtest/gtest.h>
+#include "pqc_ledger/pqc_ledger.hpp"
+#include "test_util.hpp"
+#include <vector>
+#include <algorithm>
+#include <memory_resource>
+
+using namespace pqc_ledger;
+
+TEST(TxBatch, ColumnsAndArenaRoundTrip) {
+    std::vector<Transaction> txs;
+    for (uint64_t i = 1; i <= 6; ++i) {
+        txs.push_back(make_tx(i, i % 2 == 0 ? AuthMode::Hybrid : AuthMode::PqOnly));
+    }
+
+    tx::TxBatch batch;
+    batch.reserve(txs.size());
+    for (const auto& tx : txs) {
+        batch.push_back(tx);
+    }
+    ASSERT_EQ(batch.size(), txs.size());
+
+    for (size_t i = 0; i < txs.size(); ++i) {
+        EXPECT_EQ(batch.nonces()[i], txs[i].nonce);
+        EXPECT_EQ(batch.amounts()[i], txs[i].amount);
+        EXPECT_EQ(batch.fees()[i], txs[i].fee);
+        EXPECT_EQ(batch.chain_ids()[i], txs[i].chain_id);
+        EXPECT_EQ(batch.auth_modes()[i], txs[i].auth_mode);
+        EXPECT_EQ(batch.recipients()[i], txs[i].to);
+
+        // Re-encoding the stored copy must reproduce the original bytes
+        auto expected = codec::encode(txs[i]);
+        auto actual = codec::encode(batch.to_transaction(i));
+        ASSERT_TRUE(expected.is_ok());
+        ASSERT_TRUE(actual.is_ok());
+        EXPECT_EQ(actual.value(), expected.value()) << "index " << i;
+    }
+
+    batch.clear();
+    EXPECT_TRUE(batch.empty());
+    EXPECT_EQ(batch.arena_size(), 0u);
+}
+
+TEST(TxBatch, DecodeBatchSkipsMalformedInputs) {
+    std::vector<std::vector<uint8_t>> encoded;
+    for (uint64_t i = 1; i <= 4; ++i) {
+        auto result = codec::encode(make_tx(i, AuthMode::PqOnly));
+        ASSERT_TRUE(result.is_ok());
+        encoded.push_back(result.value());
+    }
+    encoded[1].push_back(0x00);  // Trailing byte
+    encoded[2][0] = 2;           // Bad version
+
+    std::vector<ByteSpan> inputs(encoded.begin(), encoded.end());
+    tx::TxBatch batch;
+    auto statuses = tx::decode_batch(inputs, batch);
+    ASSERT_EQ(statuses.size(), 4u);
+    EXPECT_TRUE(statuses[0].ok);
+    EXPECT_FALSE(statuses[1].ok);
+    EXPECT_EQ(statuses[1].error, ErrorCode::TrailingBytes);
+    EXPECT_FALSE(statuses[2].ok);
+    EXPECT_EQ(statuses[2].error, ErrorCode::InvalidVersion);
+    EXPECT_TRUE(statuses[3].ok);
+
+    // Decoded inputs are appended in input order
+    ASSERT_EQ(batch.size(), 2u);
+    EXPECT_EQ(batch.nonces()[0], 1u);
+    EXPECT_EQ(batch.nonces()[1], 4u);
+
+    // The batch owns its bytes; the inputs can go away
+    encoded.clear();
+    auto reencoded = codec::encode(batch.to_transaction(1));
+    ASSERT_TRUE(reencoded.is_ok());
+    auto expected = codec::encode(make_tx(4, AuthMode::PqOnly));
+    EXPECT_EQ(reencoded.value(), expected.value());
+}
+
+TEST(TxBatch, CheapChecksMatchSerial) {
+    std::vector<Transaction> txs;
+    for (uint64_t i = 1; i <= 10; ++i) {
+        txs.push_back(make_tx(i, i % 3 == 0 ? AuthMode::Hybrid : AuthMode::PqOnly));
+    }
+    txs[0].chain_id = 2;
+    txs[1].nonce = 0;
+    txs[2].amount = 0;
+    txs[3].fee = 0;
+    txs[4].from_pubkey.pop_back();
+    std::get<HybridSignature>(txs[5].auth).classical_sig.pop_back();
+    std::get<PqSignature>(txs[6].auth).sig.pop_back();
+    txs[7].amount = 0;  // Two failures: the first one in check order wins
+    txs[7].fee = 0;
+
+    tx::TxBatch batch;
+    for (const auto& tx : txs) {
+        batch.push_back(tx);
+    }
+
+    auto statuses = tx::validate_cheap_checks_batch(batch, 1);
+    ASSERT_EQ(statuses.size(), txs.size());
+    for (size_t i = 0; i < txs.size(); ++i) {
+        auto serial = tx::validate_cheap_checks(txs[i], 1);
+        EXPECT_EQ(statuses[i].ok, serial.is_ok()) << "index " << i;
+        if (serial.is_err()) {
+            EXPECT_EQ(statuses[i].error, serial.error().code) << "index " << i;
+        }
+    }
+}
+
+TEST(TxBatch, StorageComesFromGivenResource) {
+    std::vector<std::vector<uint8_t>> encoded;
+    for (uint64_t i = 1; i <= 8; ++i) {
+        auto result = codec::encode(make_tx(i, i % 2 == 0 ? AuthMode::Hybrid : AuthMode::PqOnly));
+        ASSERT_TRUE(result.is_ok());
+        encoded.push_back(result.value());
+    }
+    std::vector<ByteSpan> inputs(encoded.begin(), encoded.end());
+
+    // Fixed region with a null upstream: any allocation outside it would throw
+    std::vector<uint8_t> region(256 * 1024);
+    std::pmr::monotonic_buffer_resource arena(region.data(), region.size(),
+                                              std::pmr::null_memory_resource());
+    tx::TxBatch batch(&arena);
+    EXPECT_EQ(batch.resource(), &arena);
+    batch.reserve(inputs.size());
+
+    auto statuses = tx::decode_batch(inputs, batch);
+    ASSERT_EQ(batch.size(), inputs.size());
+    for (const auto& status : statuses) {
+        EXPECT_TRUE(status.ok);
+    }
+
+    const uint8_t* begin = region.data();
+    const uint8_t* end = region.data() + region.size();
+    EXPECT_GE(batch.pubkey(0).data(), begin);
+    EXPECT_LT(batch.pq_sig(7).data(), end);
+    EXPECT_GE(reinterpret_cast<const uint8_t*>(batch.fees().data()), begin);
+    EXPECT_LT(reinterpret_cast<const uint8_t*>(batch.fees().data()), end);
+
+    auto reencoded = codec::encode(batch.to_transaction(5));
+    ASSERT_TRUE(reencoded.is_ok());
+    EXPECT_EQ(reencoded.value(), encoded[5]);
+}
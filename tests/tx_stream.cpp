@@ -0,0 +1,182 @@
+#include <gtest/gtest.h>
+#include "pqc_ledger/pqc_ledger.hpp"
+#include "test_util.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace pqc_ledger;
+
+// Source handing out a memory buffer at most piece bytes per call
+codec::ByteSource piecewise_source(const std::vector<uint8_t>& data, size_t piece) {
+    auto pos = std::make_shared<size_t>(0);
+    return [&data, piece, pos](MutableByteSpan out) -> Result<size_t> {
+        size_t count = std::min({piece, out.size(), data.size() - *pos});
+        std::memcpy(out.data(), data.data() + *pos, count);
+        *pos += count;
+        return Result<size_t>::Ok(count);
+    };
+}
+
+std::vector<uint8_t> write_stream(const std::vector<Transaction>& txs, bool checksums) {
+    std::vector<uint8_t> stream;
+    codec::TxStreamWriterOptions options;
+    options.checksums = checksums;
+    options.buffer_size = 16 * 1024;  // Several flushes for the test data
+    codec::TxStreamWriter writer(codec::vector_sink(stream), options);
+    for (const auto& tx : txs) {
+        EXPECT_TRUE(writer.write(tx).is_ok());
+    }
+    EXPECT_TRUE(writer.flush().is_ok());
+    EXPECT_EQ(writer.records_written(), txs.size());
+    return stream;
+}
+
+void expect_reads_back(codec::TxStreamReader& reader, const std::vector<Transaction>& txs) {
+    TransactionView view;
+    for (size_t i = 0; i < txs.size(); ++i) {
+        auto more = reader.next(view);
+        ASSERT_TRUE(more.is_ok()) << "record " << i << ": " << more.error().message;
+        ASSERT_TRUE(more.value()) << "record " << i;
+        EXPECT_EQ(codec::encode(view.to_transaction()).value(), codec::encode(txs[i]).value())
+            << "record " << i;
+    }
+    auto end = reader.next(view);
+    ASSERT_TRUE(end.is_ok());
+    EXPECT_FALSE(end.value());
+    EXPECT_EQ(reader.records_read(), txs.size());
+}
+
+TEST(TxStream, RoundTripFromMemoryAndSource) {
+    std::vector<Transaction> txs;
+    for (uint64_t i = 1; i <= 12; ++i) {
+        txs.push_back(make_tx(i, i % 3 == 0 ? AuthMode::Hybrid : AuthMode::PqOnly));
+    }
+
+    for (bool checksums : {true, false}) {
+        const auto stream = write_stream(txs, checksums);
+
+        codec::TxStreamReader in_place{ByteSpan(stream)};
+        expect_reads_back(in_place, txs);
+        EXPECT_EQ(in_place.checksums(), checksums);
+        EXPECT_EQ(in_place.offset(), stream.size());
+
+        // Small reads and a buffer smaller than one record
+        codec::TxStreamReaderOptions options;
+        options.buffer_size = 1000;
+        codec::TxStreamReader pulled(piecewise_source(stream, 777), options);
+        expect_reads_back(pulled, txs);
+    }
+}
+
+TEST(TxStream, EmptyStreamIsWellFormed) {
+    std::vector<uint8_t> stream;
+    {
+        codec::TxStreamWriter writer(codec::vector_sink(stream));
+    }
+    EXPECT_EQ(stream.size(), codec::TX_STREAM_HEADER_SIZE);
+
+    codec::TxStreamReader reader{ByteSpan(stream)};
+    ByteSpan payload;
+    auto more = reader.next_record(payload);
+    ASSERT_TRUE(more.is_ok());
+    EXPECT_FALSE(more.value());
+}
+
+TEST(TxStream, Crc32cKnownValues) {
+    const std::string check = "123456789";
+    ByteSpan digits(reinterpret_cast<const uint8_t*>(check.data()), check.size());
+    EXPECT_EQ(codec::crc32c(digits), 0xE3069283u);
+
+    const std::vector<uint8_t> zeros(32, 0x00);
+    EXPECT_EQ(codec::crc32c(zeros), 0x8A9136AAu);
+
+    // Checksumming in pieces gives the same value
+    uint32_t crc = codec::crc32c(digits.first(4));
+    crc = codec::crc32c(digits.subspan(4, 5), crc);
+    EXPECT_EQ(crc, 0xE3069283u);
+}
+
+TEST(TxStream, RejectsCorruptStreams) {
+    const std::vector<Transaction> txs = {make_tx(1, AuthMode::PqOnly),
+                                          make_tx(2, AuthMode::Hybrid)};
+    const auto stream = write_stream(txs, true);
+
+    auto first_error = [](const std::vector<uint8_t>& bytes,
+                          const codec::TxStreamReaderOptions& options = {}) {
+        codec::TxStreamReader reader(ByteSpan(bytes), options);
+        ByteSpan payload;
+        while (true) {
+            auto more = reader.next_record(payload);
+            if (more.is_err()) {
+                return more.error().code;
+            }
+            if (!more.value()) {
+                return ErrorCode::UnknownError;  // No error
+            }
+        }
+    };
+
+    EXPECT_EQ(first_error(stream), ErrorCode::UnknownError);
+
+    auto flipped = stream;
+    flipped[codec::TX_STREAM_HEADER_SIZE + 4 + 100] ^= 0x01;
+    EXPECT_EQ(first_error(flipped), ErrorCode::ChecksumMismatch);
+
+    auto truncated = stream;
+    truncated.pop_back();
+    EXPECT_EQ(first_error(truncated), ErrorCode::InvalidLengthPrefix);
+
+    auto bad_magic = stream;
+    bad_magic[0] = 'X';
+    EXPECT_EQ(first_error(bad_magic), ErrorCode::InvalidStreamHeader);
+
+    auto bad_version = stream;
+    bad_version[4] = 2;
+    EXPECT_EQ(first_error(bad_version), ErrorCode::InvalidStreamHeader);
+
+    EXPECT_EQ(first_error(std::vector<uint8_t>(stream.begin(), stream.begin() + 5)),
+              ErrorCode::InvalidStreamHeader);
+
+    codec::TxStreamReaderOptions small;
+    small.max_record_size = 1024;
+    EXPECT_EQ(first_error(stream, small), ErrorCode::InvalidLengthPrefix);
+
+    // A record that checksums fine but is not a transaction
+    std::vector<uint8_t> junk_stream;
+    {
+        codec::TxStreamWriter writer(codec::vector_sink(junk_stream));
+        const std::vector<uint8_t> junk = {1, 2, 3};
+        ASSERT_TRUE(writer.write_record(junk).is_ok());
+        ASSERT_TRUE(writer.flush().is_ok());
+    }
+    codec::TxStreamReader reader{ByteSpan(junk_stream)};
+    TransactionView view;
+    EXPECT_TRUE(reader.next(view).is_err());
+}
+
+TEST(TxStream, FileDescriptorRoundTrip) {
+    std::FILE* file = std::tmpfile();
+    ASSERT_NE(file, nullptr);
+    const int fd = fileno(file);
+
+    std::vector<Transaction> txs;
+    for (uint64_t i = 1; i <= 5; ++i) {
+        txs.push_back(make_tx(i, AuthMode::PqOnly));
+    }
+    {
+        codec::TxStreamWriter writer(codec::fd_sink(fd));
+        for (const auto& tx : txs) {
+            ASSERT_TRUE(writer.write(tx).is_ok());
+        }
+        ASSERT_TRUE(writer.flush().is_ok());
+    }
+
+    std::rewind(file);
+    codec::TxStreamReader reader(codec::fd_source(fd));
+    expect_reads_back(reader, txs);
+    std::fclose(file);
+}
@@ -302,3 +302,80 @@ TEST(ValidationTests, ChainReplayMustFail) {
         << "Verification with different chain_id must fail (replay prevention)";
 }
 
+
+TEST(ValidationTests, PrecheckRawMatchesCheapChecks) {
+    auto [signed_tx, encoded] = create_valid_signed_tx();
+    ASSERT_FALSE(encoded.empty()) << "Failed to create and sign transaction";
+    
+    // Each variant breaks one cheap-check rule (or none)
+    std::vector<Transaction> variants(8, signed_tx);
+    variants[1].chain_id = 2;
+    variants[2].nonce = 0;
+    variants[3].amount = 0;
+    variants[4].fee = 0;
+    variants[5].amount = 0;  // Two failures: the first one in check order wins
+    variants[5].fee = 0;
+    variants[6].auth = PqSignature{{}};  // Unsigned
+    variants[7].auth_mode = AuthMode::Hybrid;
+    variants[7].auth = HybridSignature{std::vector<uint8_t>(ED25519_SIG_SIZE, 0x11),
+                                       std::get<PqSignature>(signed_tx.auth).sig};
+    
+    for (size_t i = 0; i < variants.size(); ++i) {
+        auto wire = codec::encode(variants[i]);
+        ASSERT_TRUE(wire.is_ok());
+        
+        auto expected = tx::validate_cheap_checks(variants[i], 1);
+        ErrorCode error = ErrorCode::UnknownError;
+        bool passed = tx::precheck_raw(wire.value(), 1, error);
+        EXPECT_EQ(passed, expected.is_ok()) << "variant " << i;
+        if (expected.is_err()) {
+            EXPECT_EQ(error, expected.error().code) << "variant " << i;
+        }
+    }
+    
+    // Shape errors that only exist on the wire
+    ErrorCode error = ErrorCode::UnknownError;
+    EXPECT_FALSE(tx::precheck_raw(ByteSpan(encoded.data(), 100), 1, error));
+    EXPECT_EQ(error, ErrorCode::InvalidLengthPrefix);
+    
+    auto trailing = encoded;
+    trailing.push_back(0x00);
+    EXPECT_FALSE(tx::precheck_raw(trailing, 1, error));
+    EXPECT_EQ(error, ErrorCode::InvalidSignature);
+    
+    auto bad_tag = encoded;
+    bad_tag[FixedTransaction::kAuthTagOffset] = 7;
+    EXPECT_FALSE(tx::precheck_raw(bad_tag, 1, error));
+    EXPECT_EQ(error, ErrorCode::InvalidAuthTag);
+}
+
+TEST(ValidationTests, PrecheckRawChecksHeaderBeforePublicKey) {
+    auto [signed_tx, encoded] = create_valid_signed_tx();
+    ASSERT_FALSE(encoded.empty()) << "Failed to create and sign transaction";
+    
+    // Wrong chain and wrong key length: the chain comes first in both checks
+    Transaction tx = signed_tx;
+    tx.chain_id = 2;
+    tx.from_pubkey.resize(tx.from_pubkey.size() - 1);
+    auto wire = codec::encode(tx);
+    ASSERT_TRUE(wire.is_ok());
+    
+    auto expected = tx::validate_cheap_checks(tx, 1);
+    ASSERT_TRUE(expected.is_err());
+    EXPECT_EQ(expected.error().code, ErrorCode::InvalidChainId);
+    
+    ErrorCode error = ErrorCode::UnknownError;
+    EXPECT_FALSE(tx::precheck_raw(wire.value(), 1, error));
+    EXPECT_EQ(error, ErrorCode::InvalidChainId);
+    
+    // With the right chain, the key length is what fails
+    tx.chain_id = 1;
+    wire = codec::encode(tx);
+    ASSERT_TRUE(wire.is_ok());
+    EXPECT_FALSE(tx::precheck_raw(wire.value(), 1, error));
+    EXPECT_EQ(error, ErrorCode::InvalidPublicKey);
+    
+    // Too short to hold the nonce
+    EXPECT_FALSE(tx::precheck_raw(ByteSpan(encoded.data(), 12), 1, error));
+    EXPECT_EQ(error, ErrorCode::InvalidLengthPrefix);
+}
@@ -0,0 +1,273 @@
+#include <gtest/gtest.h>
+#include "pqc_ledger/pqc_ledger.hpp"
+#include "test_util.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if defined(_WIN32)
+#include <process.h>
+#define getpid _getpid
+#else
+#include <unistd.h>
+#endif
+
+using namespace pqc_ledger;
+
+Hash32 synthetic_key(uint8_t seed) {
+    Hash32 key{};
+    std::fill(key.begin(), key.end(), seed);
+    return key;
+}
+
+std::string temp_path(const std::string& name) {
+    return ::testing::TempDir() + "pqc_ledger_" + name + "_" + std::to_string(getpid());
+}
+
+std::vector<uint8_t> read_file(const std::string& path) {
+    std::ifstream file(path, std::ios::binary);
+    return std::vector<uint8_t>((std::istreambuf_iterator<char>(file)),
+                                std::istreambuf_iterator<char>());
+}
+
+void write_file(const std::string& path, const std::vector<uint8_t>& bytes) {
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    file.write(reinterpret_cast<const char*>(bytes.data()),
+               static_cast<std::streamsize>(bytes.size()));
+}
+
+TEST(VerifyCache, CachesOnlySuccessfulVerifications) {
+    auto txs = create_signed_txs(1);
+    ASSERT_EQ(txs.size(), 1u) << "Failed to create signed transactions";
+
+    tx::VerifyCache cache;
+    auto first = tx::verify_transaction(txs[0], 1, cache);
+    ASSERT_TRUE(first.is_ok());
+    EXPECT_TRUE(first.value());
+    auto second = tx::verify_transaction(txs[0], 1, cache);
+    ASSERT_TRUE(second.is_ok());
+    EXPECT_TRUE(second.value());
+
+    auto stats = cache.stats();
+    EXPECT_EQ(stats.misses, 1u);
+    EXPECT_EQ(stats.hits, 1u);
+    EXPECT_EQ(stats.insertions, 1u);
+    EXPECT_EQ(cache.size(), 1u);
+
+    // A failed verification is looked up but never cached
+    Transaction tampered = txs[0];
+    std::get<PqSignature>(tampered.auth).sig[10] ^= 0x01;
+    for (int i = 0; i < 2; ++i) {
+        auto result = tx::verify_transaction(tampered, 1, cache);
+        ASSERT_TRUE(result.is_ok());
+        EXPECT_FALSE(result.value());
+    }
+    EXPECT_EQ(cache.stats().misses, 3u);
+    EXPECT_EQ(cache.size(), 1u);
+
+    // The chain is part of the signing message, hence of the key
+    auto wrong_chain = tx::verify_transaction(txs[0], 2, cache);
+    ASSERT_TRUE(wrong_chain.is_ok());
+    EXPECT_FALSE(wrong_chain.value());
+}
+
+TEST(VerifyCache, SharedAcrossEntryPoints) {
+    auto txs = create_signed_txs(6);
+    ASSERT_EQ(txs.size(), 6u) << "Failed to create signed transactions";
+
+    tx::VerifyCache cache;
+
+    // Mempool admission fills the cache...
+    tx::ValidationOptions options;
+    options.cache = &cache;
+    for (size_t i = 0; i < 3; ++i) {
+        auto valid = tx::validate_transaction(txs[i], 1, options);
+        ASSERT_TRUE(valid.is_ok());
+        EXPECT_TRUE(valid.value());
+    }
+    EXPECT_EQ(cache.stats().misses, 3u);
+
+    // ...and block validation of the same transactions hits it, whether they
+    // arrive decoded or on the wire
+    auto encoded = codec::encode(txs[0]).value();
+    auto from_wire = tx::verify_encoded(encoded, 1, cache);
+    ASSERT_TRUE(from_wire.is_ok());
+    EXPECT_TRUE(from_wire.value());
+    EXPECT_EQ(cache.stats().hits, 1u);
+
+    tx::BatchVerifyOptions batch_options;
+    batch_options.num_threads = 4;
+    batch_options.min_per_thread = 1;
+    batch_options.cache = &cache;
+    auto outcomes = tx::verify_batch(txs, 1, batch_options);
+    for (const auto& outcome : outcomes) {
+        EXPECT_EQ(outcome.status, tx::VerifyStatus::Valid);
+    }
+    auto stats = cache.stats();
+    EXPECT_EQ(stats.hits, 4u);
+    EXPECT_EQ(stats.misses, 6u);
+    EXPECT_EQ(cache.size(), txs.size());
+}
+
+TEST(VerifyCache, KeysAreSaltedPerCache) {
+    tx::VerifyCache a;
+    tx::VerifyCache b;
+    const Hash32 message = synthetic_key(0x5A);
+    const std::vector<uint8_t> pubkey(PQ_PUBKEY_SIZE, 0x01);
+    const std::vector<uint8_t> sig(PQ_SIG_SIZE, 0x02);
+
+    const Hash32 key = a.key(AuthMode::PqOnly, message, pubkey, ByteSpan(), sig);
+    EXPECT_EQ(key, a.key(AuthMode::PqOnly, message, pubkey, ByteSpan(), sig));
+    EXPECT_NE(key, b.key(AuthMode::PqOnly, message, pubkey, ByteSpan(), sig));
+    EXPECT_NE(key, a.key(AuthMode::Hybrid, message, pubkey, ByteSpan(), sig));
+
+    // Moving a byte from the public key to the signature changes the key
+    const ByteSpan shorter_pubkey(pubkey.data(), pubkey.size() - 1);
+    std::vector<uint8_t> longer_sig(sig);
+    longer_sig.insert(longer_sig.begin(), 0x01);
+    EXPECT_NE(key, a.key(AuthMode::PqOnly, message, shorter_pubkey, ByteSpan(), longer_sig));
+}
+
+TEST(VerifyCache, EvictsOldestWhenFull) {
+    tx::VerifyCache cache(4, 1);
+    EXPECT_EQ(cache.capacity(), 4u);
+
+    for (uint8_t i = 0; i < 6; ++i) {
+        cache.insert(synthetic_key(i));
+    }
+    cache.insert(synthetic_key(5));  // Already present: no insertion, no eviction
+
+    EXPECT_EQ(cache.size(), 4u);
+    EXPECT_FALSE(cache.contains(synthetic_key(0)));
+    EXPECT_FALSE(cache.contains(synthetic_key(1)));
+    for (uint8_t i = 2; i < 6; ++i) {
+        EXPECT_TRUE(cache.contains(synthetic_key(i)));
+    }
+    auto stats = cache.stats();
+    EXPECT_EQ(stats.insertions, 6u);
+    EXPECT_EQ(stats.evictions, 2u);
+
+    cache.clear();
+    EXPECT_EQ(cache.size(), 0u);
+    EXPECT_FALSE(cache.contains(synthetic_key(5)));
+}
+
+TEST(VerifyCache, ConcurrentUseStaysBounded) {
+    tx::VerifyCache cache(256, 8);
+    EXPECT_EQ(cache.capacity(), 256u);
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([&cache, t] {
+            for (int i = 0; i < 2000; ++i) {
+                Hash32 key{};
+                key[0] = static_cast<uint8_t>(t);
+                key[8] = static_cast<uint8_t>(i);
+                key[9] = static_cast<uint8_t>(i >> 8);
+                key[1] = key[8];
+                key[2] = key[9];
+                if (!cache.contains(key)) {
+                    cache.insert(key);
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    auto stats = cache.stats();
+    EXPECT_EQ(stats.hits + stats.misses, 8000u);
+    EXPECT_LE(cache.size(), cache.capacity());
+    EXPECT_EQ(stats.insertions - stats.evictions, cache.size());
+}
+
+TEST(VerifyCache, SnapshotSurvivesRestart) {
+    auto txs = create_signed_txs(3);
+    ASSERT_EQ(txs.size(), 3u) << "Failed to create signed transactions";
+    const std::string path = temp_path("verify_cache_restart");
+
+    {
+        tx::VerifyCache before;
+        for (const auto& tx : txs) {
+            ASSERT_TRUE(tx::verify_transaction(tx, 1, before).value());
+        }
+        ASSERT_TRUE(before.save(path).is_ok());
+    }
+
+    // A fresh cache (with its own salt) adopts the snapshot's salt and keys
+    tx::VerifyCache after;
+    auto loaded = after.load(path);
+    ASSERT_TRUE(loaded.is_ok()) << loaded.error().message;
+    EXPECT_EQ(loaded.value(), txs.size());
+    for (const auto& tx : txs) {
+        ASSERT_TRUE(tx::verify_transaction(tx, 1, after).value());
+    }
+    auto stats = after.stats();
+    EXPECT_EQ(stats.hits, txs.size());
+    EXPECT_EQ(stats.misses, 0u);
+    std::remove(path.c_str());
+}
+
+TEST(VerifyCache, SnapshotLookupInPlace) {
+    const std::string path = temp_path("verify_cache_lookup");
+    tx::VerifyCache cache(1000, 4);
+    for (uint8_t i = 1; i <= 100; ++i) {
+        cache.insert(synthetic_key(i));
+    }
+    ASSERT_TRUE(cache.save(path).is_ok());
+
+    auto snapshot = tx::VerifyCacheSnapshot::open(path);
+    ASSERT_TRUE(snapshot.is_ok()) << snapshot.error().message;
+    EXPECT_EQ(snapshot.value().size(), 100u);
+    for (uint8_t i = 1; i <= 100; ++i) {
+        EXPECT_TRUE(snapshot.value().contains(synthetic_key(i))) << int(i);
+    }
+    EXPECT_FALSE(snapshot.value().contains(synthetic_key(101)));
+    EXPECT_FALSE(snapshot.value().contains(synthetic_key(0)));
+
+    // A smaller cache keeps what fits and drops the rest
+    tx::VerifyCache small(10, 1);
+    EXPECT_EQ(small.load(snapshot.value()), 10u);
+    EXPECT_EQ(small.size(), 10u);
+    EXPECT_EQ(small.stats().insertions, 0u);
+    std::remove(path.c_str());
+}
+
+TEST(VerifyCache, SnapshotRejectsDamage) {
+    const std::string path = temp_path("verify_cache_damage");
+    tx::VerifyCache cache;
+    cache.insert(synthetic_key(7));
+    ASSERT_TRUE(cache.save(path).is_ok());
+    const auto good = read_file(path);
+    ASSERT_GT(good.size(), tx::VerifyCacheSnapshot::HEADER_SIZE);
+
+    auto open_error = [&](const std::vector<uint8_t>& bytes) {
+        write_file(path, bytes);
+        auto snapshot = tx::VerifyCacheSnapshot::open(path);
+        return snapshot.is_err() ? snapshot.error().code : ErrorCode::UnknownError;
+    };
+
+    EXPECT_EQ(open_error(good), ErrorCode::UnknownError);
+
+    auto flipped = good;
+    flipped.back() ^= 0x01;
+    EXPECT_EQ(open_error(flipped), ErrorCode::ChecksumMismatch);
+
+    auto truncated = good;
+    truncated.resize(truncated.size() - 32);
+    EXPECT_EQ(open_error(truncated), ErrorCode::InvalidSnapshot);
+
+    auto bad_magic = good;
+    bad_magic[0] = 'X';
+    EXPECT_EQ(open_error(bad_magic), ErrorCode::InvalidSnapshot);
+
+    std::remove(path.c_str());
+    tx::VerifyCache fresh;
+    auto missing = fresh.load(path);
+    ASSERT_TRUE(missing.is_err());
+    EXPECT_EQ(missing.error().code, ErrorCode::FileReadError);
+}
@@ -0,0 +1,135 @@
+#include <gtest/gtest.h>
+#include "pqc_ledger/pqc_ledger.hpp"
+#include "test_util.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace pqc_ledger;
+
+// Blocks until the coalescer has seen `count` followers, so a test can hold a
+// flight open while duplicates pile up behind it (gives up after 10 s)
+void wait_for_followers(const tx::VerifyCoalescer& coalescer, uint64_t count) {
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (coalescer.stats().coalesced < count && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::yield();
+    }
+}
+
+TEST(VerifyCoalescer, DuplicatesShareOneVerification) {
+    tx::VerifyCoalescer coalescer;
+    const Hash32 txid{};
+    constexpr int kRequests = 8;
+    std::atomic<int> runs{0};
+
+    std::vector<std::thread> threads;
+    std::vector<Result<bool>> results(kRequests);
+    for (int i = 0; i < kRequests; ++i) {
+        threads.emplace_back([&, i] {
+            results[i] = coalescer.run(txid, 1, [&]() {
+                ++runs;
+                wait_for_followers(coalescer, kRequests - 1);
+                return Result<bool>::Ok(true);
+            });
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(runs.load(), 1);
+    for (const auto& result : results) {
+        ASSERT_TRUE(result.is_ok());
+        EXPECT_TRUE(result.value());
+    }
+    auto stats = coalescer.stats();
+    EXPECT_EQ(stats.verifications, 1u);
+    EXPECT_EQ(stats.coalesced, static_cast<uint64_t>(kRequests - 1));
+    EXPECT_EQ(coalescer.in_flight(), 0u);
+}
+
+TEST(VerifyCoalescer, KeysIncludeTheChain) {
+    tx::VerifyCoalescer coalescer;
+    const Hash32 txid{};
+
+    // A flight on chain 1 does not capture a request for chain 2
+    std::thread leader([&] {
+        coalescer.run(txid, 1, [&]() {
+            wait_for_followers(coalescer, 1);
+            return Result<bool>::Ok(true);
+        });
+    });
+    while (coalescer.in_flight() == 0) {
+        std::this_thread::yield();
+    }
+    auto other_chain = coalescer.run(txid, 2, []() { return Result<bool>::Ok(false); });
+    EXPECT_FALSE(other_chain.value());
+    EXPECT_EQ(coalescer.stats().verifications, 2u);
+
+    auto same_chain = coalescer.run(txid, 1, []() { return Result<bool>::Ok(false); });
+    leader.join();
+    EXPECT_TRUE(same_chain.value());
+}
+
+TEST(VerifyCoalescer, ExceptionsReachEveryWaiter) {
+    tx::VerifyCoalescer coalescer;
+    const Hash32 txid{};
+
+    std::thread leader([&] {
+        EXPECT_THROW(coalescer.run(txid, 1, [&]() -> Result<bool> {
+            wait_for_followers(coalescer, 1);
+            throw std::runtime_error("verifier failed");
+        }), std::runtime_error);
+    });
+    while (coalescer.in_flight() == 0) {
+        std::this_thread::yield();
+    }
+    EXPECT_THROW(coalescer.run(txid, 1, []() { return Result<bool>::Ok(true); }),
+                 std::runtime_error);
+    leader.join();
+
+    // The failed flight is gone; the next request runs again
+    auto retry = coalescer.run(txid, 1, []() { return Result<bool>::Ok(true); });
+    EXPECT_TRUE(retry.value());
+}
+
+TEST(VerifyCoalescer, VerifiesRealTransactions) {
+    auto txs = create_signed_txs(1);
+    ASSERT_EQ(txs.size(), 1u) << "Failed to create signed transaction";
+    const Transaction& tx = txs[0];
+    auto encoded = codec::encode(tx).value();
+
+    tx::VerifyCache cache;
+    tx::VerifyCoalescer coalescer(&cache);
+
+    std::vector<std::thread> threads;
+    std::atomic<int> valid{0};
+    for (int i = 0; i < 6; ++i) {
+        threads.emplace_back([&, i] {
+            auto result = i % 2 == 0 ? coalescer.verify_encoded(encoded, 1)
+                                     : coalescer.verify_transaction(tx, 1);
+            if (result.is_ok() && result.value()) {
+                ++valid;
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(valid.load(), 6);
+
+    // Whatever was not coalesced hit the cache after the first verification
+    auto stats = coalescer.stats();
+    EXPECT_EQ(stats.verifications + stats.coalesced, 6u);
+    EXPECT_EQ(cache.stats().misses, 1u);
+    EXPECT_EQ(cache.stats().hits, stats.verifications - 1);
+
+    Transaction tampered = tx;
+    tampered.amount += 1;
+    auto invalid = coalescer.verify_transaction(tampered, 1);
+    ASSERT_TRUE(invalid.is_ok());
+    EXPECT_FALSE(invalid.value());
+}